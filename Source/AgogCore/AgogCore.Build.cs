@@ -173,6 +173,10 @@ public class AgogCore : ModuleRules
     {
       // We're building SkookumScript from source - not much else needed
       PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Private"));
+
+      // Lets headers enable changes that alter the layout of classes shared with the
+      // prebuilt libraries
+      Definitions.Add("A_FULL_SOURCE");
     }
     else if (bPlatformAllowed)
     {
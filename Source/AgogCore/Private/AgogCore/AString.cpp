@@ -49,6 +49,366 @@
 #pragma clang diagnostic ignored "-Wchar-subscripts" // Allow char-typed indices into arrays
 #endif
 
+#if !defined(A_STR_NO_SIMD) && (defined(_M_X64) || defined(__x86_64__))
+  // SSE2 is part of the x64 base instruction set
+  #define A_STR_SIMD_SSE2
+  #include <emmintrin.h>
+#elif !defined(A_STR_NO_SIMD) && (defined(_M_ARM64) || defined(__aarch64__))
+  #define A_STR_SIMD_NEON
+  #include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(A_STR_SIMD_SSE2) || defined(A_STR_SIMD_NEON))
+  #include <intrin.h>     // Uses:  _BitScanForward64, _BitScanReverse64
+#endif
+
+
+//=======================================================================================
+// Local Functions
+//=======================================================================================
+
+// Use unnamed namespace so that global namespace is not cluttered up
+namespace
+{
+
+  // Character scanning kernels used by the search, count and case-insensitive compare
+  // methods.  With SSE2 (x64) or NEON (ARM64) available 16 characters are tested at
+  // once, otherwise - or if A_STR_NO_SIMD is defined - plain character loops are used.
+  // They never read outside of the character ranges they are given.
+
+  //---------------------------------------------------------------------------------------
+  // ASCII only lowercase - same as AString::ms_char2lower[]
+  A_FORCEINLINE char scan_fold(char ch)
+    {
+    return ((ch >= 'A') && (ch <= 'Z')) ? char(ch + ('a' - 'A')) : ch;
+    }
+
+  #if defined(A_STR_SIMD_SSE2) || defined(A_STR_SIMD_NEON)
+
+    #define A_STR_SIMD
+
+    #if defined(A_STR_SIMD_SSE2)
+
+      typedef __m128i tScanVec;
+
+      enum
+        {
+        // Bits of a comparison mask set per matching character
+        Scan_mask_shift = 0
+        };
+
+      const uint64_t Scan_mask_char = 0x1u;
+      const uint64_t Scan_mask_all  = 0xffffu;
+
+      A_FORCEINLINE tScanVec scan_load(const char * cstr_p)          { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(cstr_p)); }
+      A_FORCEINLINE tScanVec scan_splat(char ch)                     { return _mm_set1_epi8(ch); }
+      A_FORCEINLINE tScanVec scan_eq(tScanVec lhs, tScanVec rhs)     { return _mm_cmpeq_epi8(lhs, rhs); }
+      A_FORCEINLINE tScanVec scan_and(tScanVec lhs, tScanVec rhs)    { return _mm_and_si128(lhs, rhs); }
+      A_FORCEINLINE uint64_t scan_mask(tScanVec cmp)                 { return uint64_t(uint32_t(_mm_movemask_epi8(cmp))); }
+
+      // ASCII only lowercase of 16 characters - characters 0x80+ are negative so never in range
+      A_FORCEINLINE tScanVec scan_fold(tScanVec chars)
+        {
+        tScanVec upper = _mm_and_si128(
+          _mm_cmpgt_epi8(chars, _mm_set1_epi8('A' - 1)),
+          _mm_cmplt_epi8(chars, _mm_set1_epi8('Z' + 1)));
+
+        return _mm_or_si128(chars, _mm_and_si128(upper, _mm_set1_epi8('a' - 'A')));
+        }
+
+    #else  // A_STR_SIMD_NEON
+
+      typedef uint8x16_t tScanVec;
+
+      enum
+        {
+        // NEON has no movemask so 4 bits are set per matching character
+        Scan_mask_shift = 2
+        };
+
+      const uint64_t Scan_mask_char = 0xfu;
+      const uint64_t Scan_mask_all  = ~uint64_t(0u);
+
+      A_FORCEINLINE tScanVec scan_load(const char * cstr_p)          { return vld1q_u8(reinterpret_cast<const uint8_t *>(cstr_p)); }
+      A_FORCEINLINE tScanVec scan_splat(char ch)                     { return vdupq_n_u8(uint8_t(ch)); }
+      A_FORCEINLINE tScanVec scan_eq(tScanVec lhs, tScanVec rhs)     { return vceqq_u8(lhs, rhs); }
+      A_FORCEINLINE tScanVec scan_and(tScanVec lhs, tScanVec rhs)    { return vandq_u8(lhs, rhs); }
+      A_FORCEINLINE uint64_t scan_mask(tScanVec cmp)                 { return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4)), 0); }
+
+      // ASCII only lowercase of 16 characters
+      A_FORCEINLINE tScanVec scan_fold(tScanVec chars)
+        {
+        tScanVec upper = vandq_u8(vcgeq_u8(chars, vdupq_n_u8('A')), vcleq_u8(chars, vdupq_n_u8('Z')));
+
+        return vorrq_u8(chars, vandq_u8(upper, vdupq_n_u8('a' - 'A')));
+        }
+
+    #endif
+
+    enum
+      {
+      // Characters tested at once
+      Scan_block = 16
+      };
+
+    //---------------------------------------------------------------------------------------
+    // Index of the lowest set bit - mask must not be 0
+    A_FORCEINLINE uint32_t scan_bit_first(uint64_t mask)
+      {
+      #ifdef _MSC_VER
+        unsigned long bit;
+        _BitScanForward64(&bit, mask);
+        return uint32_t(bit);
+      #else
+        return uint32_t(__builtin_ctzll(mask));
+      #endif
+      }
+
+    //---------------------------------------------------------------------------------------
+    // Index of the highest set bit - mask must not be 0
+    A_FORCEINLINE uint32_t scan_bit_last(uint64_t mask)
+      {
+      #ifdef _MSC_VER
+        unsigned long bit;
+        _BitScanReverse64(&bit, mask);
+        return uint32_t(bit);
+      #else
+        return 63u - uint32_t(__builtin_clzll(mask));
+      #endif
+      }
+
+    //---------------------------------------------------------------------------------------
+    // Number of set bits - POPCNT is not part of the x64 base instruction set
+    A_FORCEINLINE uint32_t scan_bit_count(uint64_t mask)
+      {
+      mask = mask - ((mask >> 1u) & 0x5555555555555555ull);
+      mask = (mask & 0x3333333333333333ull) + ((mask >> 2u) & 0x3333333333333333ull);
+      mask = (mask + (mask >> 4u)) & 0x0f0f0f0f0f0f0f0full;
+
+      return uint32_t((mask * 0x0101010101010101ull) >> 56u);
+      }
+
+  #endif  // A_STR_SIMD_SSE2 || A_STR_SIMD_NEON
+
+  //---------------------------------------------------------------------------------------
+  // Returns first occurrence of ch in [cstr_p, end_p) or end_p if not present
+  const char * scan_char(const char * cstr_p, const char * end_p, char ch)
+    {
+    #ifdef A_STR_SIMD
+      tScanVec ch_vec = scan_splat(ch);
+
+      for (; (end_p - cstr_p) >= Scan_block; cstr_p += Scan_block)
+        {
+        uint64_t mask = scan_mask(scan_eq(scan_load(cstr_p), ch_vec));
+
+        if (mask)
+          {
+          return cstr_p + (scan_bit_first(mask) >> Scan_mask_shift);
+          }
+        }
+    #endif
+
+    for (; cstr_p < end_p; cstr_p++)
+      {
+      if (*cstr_p == ch)
+        {
+        return cstr_p;
+        }
+      }
+
+    return end_p;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Returns last occurrence of ch in [cstr_p, end_p) or nullptr if not present
+  const char * scan_char_reverse(const char * cstr_p, const char * end_p, char ch)
+    {
+    #ifdef A_STR_SIMD
+      tScanVec ch_vec = scan_splat(ch);
+
+      for (; (end_p - cstr_p) >= Scan_block; end_p -= Scan_block)
+        {
+        uint64_t mask = scan_mask(scan_eq(scan_load(end_p - Scan_block), ch_vec));
+
+        if (mask)
+          {
+          return end_p - Scan_block + (scan_bit_last(mask) >> Scan_mask_shift);
+          }
+        }
+    #endif
+
+    while (end_p > cstr_p)
+      {
+      end_p--;
+
+      if (*end_p == ch)
+        {
+        return end_p;
+        }
+      }
+
+    return nullptr;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Returns number of occurrences of ch in [cstr_p, end_p) and stores the last one in
+  // last_pp (which is left unchanged if there are none)
+  uint32_t scan_count_char(const char * cstr_p, const char * end_p, char ch, const char ** last_pp)
+    {
+    uint32_t count = 0u;
+
+    #ifdef A_STR_SIMD
+      tScanVec ch_vec = scan_splat(ch);
+
+      for (; (end_p - cstr_p) >= Scan_block; cstr_p += Scan_block)
+        {
+        uint64_t mask = scan_mask(scan_eq(scan_load(cstr_p), ch_vec));
+
+        if (mask)
+          {
+          count    += scan_bit_count(mask) >> Scan_mask_shift;
+          *last_pp  = cstr_p + (scan_bit_last(mask) >> Scan_mask_shift);
+          }
+        }
+    #endif
+
+    for (; cstr_p < end_p; cstr_p++)
+      {
+      if (*cstr_p == ch)
+        {
+        *last_pp = cstr_p;
+        count++;
+        }
+      }
+
+    return count;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Returns index of the first character that differs (ignoring ASCII case) between
+  // lhs_p and rhs_p or length if they are equal for length characters
+  uint32_t scan_imismatch(const char * lhs_p, const char * rhs_p, uint32_t length)
+    {
+    uint32_t idx = 0u;
+
+    #ifdef A_STR_SIMD
+      for (; (length - idx) >= uint32_t(Scan_block); idx += Scan_block)
+        {
+        uint64_t mask = scan_mask(scan_eq(scan_fold(scan_load(lhs_p + idx)), scan_fold(scan_load(rhs_p + idx))));
+
+        if (mask != Scan_mask_all)
+          {
+          return idx + (scan_bit_first(~mask & Scan_mask_all) >> Scan_mask_shift);
+          }
+        }
+    #endif
+
+    for (; idx < length; idx++)
+      {
+      if (scan_fold(lhs_p[idx]) != scan_fold(rhs_p[idx]))
+        {
+        return idx;
+        }
+      }
+
+    return length;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Returns first occurrence of sub_p (with sub_length of at least 1) that starts in
+  // [cstr_p, last_p] or nullptr if not present.  The whole of each candidate must be
+  // readable.
+  //
+  // Candidates are filtered by testing their first and last characters for a whole block
+  // of start positions at once so that the remaining characters are only compared for
+  // likely matches.
+  const char * scan_substr(const char * cstr_p, const char * last_p, const char * sub_p, uint32_t sub_length)
+    {
+    char   first_ch  = sub_p[0u];
+    size_t rest_size = sub_length - 1u;
+
+    #ifdef A_STR_SIMD
+      tScanVec first_vec = scan_splat(first_ch);
+      tScanVec last_vec  = scan_splat(sub_p[rest_size]);
+
+      for (; (last_p - cstr_p) >= (Scan_block - 1); cstr_p += Scan_block)
+        {
+        uint64_t mask = scan_mask(scan_and(
+          scan_eq(scan_load(cstr_p), first_vec),
+          scan_eq(scan_load(cstr_p + rest_size), last_vec)));
+
+        while (mask)
+          {
+          uint32_t     bit    = scan_bit_first(mask);
+          const char * cand_p = cstr_p + (bit >> Scan_mask_shift);
+
+          if (::memcmp(cand_p + 1, sub_p + 1, rest_size) == 0)
+            {
+            return cand_p;
+            }
+
+          mask &= ~(Scan_mask_char << bit);
+          }
+        }
+    #endif
+
+    for (; cstr_p <= last_p; cstr_p++)
+      {
+      if ((*cstr_p == first_ch) && (::memcmp(cstr_p + 1, sub_p + 1, rest_size) == 0))
+        {
+        return cstr_p;
+        }
+      }
+
+    return nullptr;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Same as scan_substr() though ignoring ASCII case
+  const char * scan_isubstr(const char * cstr_p, const char * last_p, const char * sub_p, uint32_t sub_length)
+    {
+    char     first_ch    = scan_fold(sub_p[0u]);
+    uint32_t rest_length = sub_length - 1u;
+
+    #ifdef A_STR_SIMD
+      tScanVec first_vec = scan_splat(first_ch);
+      tScanVec last_vec  = scan_splat(scan_fold(sub_p[rest_length]));
+
+      for (; (last_p - cstr_p) >= (Scan_block - 1); cstr_p += Scan_block)
+        {
+        uint64_t mask = scan_mask(scan_and(
+          scan_eq(scan_fold(scan_load(cstr_p)), first_vec),
+          scan_eq(scan_fold(scan_load(cstr_p + rest_length)), last_vec)));
+
+        while (mask)
+          {
+          uint32_t     bit    = scan_bit_first(mask);
+          const char * cand_p = cstr_p + (bit >> Scan_mask_shift);
+
+          if (scan_imismatch(cand_p + 1, sub_p + 1, rest_length) == rest_length)
+            {
+            return cand_p;
+            }
+
+          mask &= ~(Scan_mask_char << bit);
+          }
+        }
+    #endif
+
+    for (; cstr_p <= last_p; cstr_p++)
+      {
+      if ((scan_fold(*cstr_p) == first_ch) && (scan_imismatch(cstr_p + 1, sub_p + 1, rest_length) == rest_length))
+        {
+        return cstr_p;
+        }
+      }
+
+    return nullptr;
+    }
+
+} // End unnamed namespace
+
+
 
 //=======================================================================================
 // AString Class Data Members
@@ -935,29 +1295,21 @@ eAEquate AString::icompare_sub(
   uint32_t        index // = 0u
   ) const
   {
-  // $Revisit - CReis This should be profiled, but I believe that the custom code is faster
-  // than the commented out section below.
-  uint8_t * str1_p     = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + index);
-  uint8_t * str1_end_p = str1_p + a_min(m_str_ref_p->m_length + 1u - index, substr.m_str_ref_p->m_length); // compare the # of characters in the shorter sub-string (without null)
-  uint8_t * str2_p     = reinterpret_cast<uint8_t *>(substr.m_str_ref_p->m_cstr_p);
-  char ch1, ch2;
+  const uint8_t * str1_p = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + index);
+  const uint8_t * str2_p = reinterpret_cast<uint8_t *>(substr.m_str_ref_p->m_cstr_p);
+  uint32_t        length = a_min(m_str_ref_p->m_length + 1u - index, substr.m_str_ref_p->m_length); // compare the # of characters in the shorter sub-string (without null)
+  uint32_t        idx    = scan_imismatch(reinterpret_cast<const char *>(str1_p), reinterpret_cast<const char *>(str2_p), length);
 
-  while (str1_p < str1_end_p)
+  if (idx == length)
     {
-    ch1 = ms_char2lower[*str1_p];
-    ch2 = ms_char2lower[*str2_p];
-
-    if (ch1 != ch2)  // if characters differ
-      {
-      // select appropriate result
-      return (ch1 < ch2) ? AEquate_less : AEquate_greater;
-      }
-
-    str1_p++;
-    str2_p++;
+    return AEquate_equal;
     }
 
-  return AEquate_equal;
+  // select appropriate result
+  char ch1 = ms_char2lower[str1_p[idx]];
+  char ch2 = ms_char2lower[str2_p[idx]];
+
+  return (ch1 < ch2) ? AEquate_less : AEquate_greater;
 
 
   // Alternate method using standard library functions.
@@ -991,8 +1343,6 @@ bool AString::is_equal(const AString & str) const
 // Author(s):    Conan Reis
 bool AString::is_iequal(const AString & str) const
   {
-  // $Revisit - CReis This should be profiled, but I believe that the custom code is faster
-  // than the standard library calls.
   uint32_t length = m_str_ref_p->m_length;
 
   if (length != str.m_str_ref_p->m_length)
@@ -1000,27 +1350,8 @@ bool AString::is_iequal(const AString & str) const
     return false;
     }
 
-  uint8_t * str1_p     = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p);
-  uint8_t * str1_end_p = str1_p + length;  // Don't bother comparing null character
-  uint8_t * str2_p     = reinterpret_cast<uint8_t *>(str.m_str_ref_p->m_cstr_p);
-  char ch1, ch2;
-
-  while (str1_p < str1_end_p)
-    {
-    ch1 = ms_char2lower[*str1_p];
-    ch2 = ms_char2lower[*str2_p];
-
-    if (ch1 != ch2)  // if characters differ
-      {
-      // select appropriate result
-      return false;
-      }
-
-    str1_p++;
-    str2_p++;
-    }
-
-  return true;
+  // Don't bother comparing null character
+  return scan_imismatch(m_str_ref_p->m_cstr_p, str.m_str_ref_p->m_cstr_p, length) == length;
   }
 
 
@@ -1930,31 +2261,33 @@ uint32_t AString::remove_all(
       bounds_check(start_pos, end_pos, "remove_all");
     #endif
 
-    // $Revisit - CReis This could be optimized - some characters may be needlessly copied
     ensure_writable();
 
-    uint8_t * cstr_p     = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + start_pos);
-    uint8_t * rewrite_p  = cstr_p;
-    uint8_t * cstr_end_p = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + end_pos);
-    uint32_t  length     = m_str_ref_p->m_length;
+    char *       cstr_start_p = m_str_ref_p->m_cstr_p;
+    const char * cstr_end_p   = cstr_start_p + end_pos + 1u;
+    const char * cstr_p       = scan_char(cstr_start_p + start_pos, cstr_end_p, ch);
+    char *       rewrite_p    = cstr_start_p + (cstr_p - cstr_start_p);  // Characters before first ch stay in place
+    const char * match_p;
+    size_t       run_length;
 
-    for (; cstr_p <= cstr_end_p; cstr_p++)
+    // Shift each run of characters between removed characters down
+    while (cstr_p < cstr_end_p)
       {
-      if (*cstr_p != ch)
-        {
-        // $Revisit - CReis assuming that a check to see if rewrite_p == cstr_p would just slow things down
-        *rewrite_p = *cstr_p;
-        rewrite_p++;
-        }
-      else
-        {
-        length--;
-        }
+      remove_count++;
+      cstr_p++;
+      match_p    = scan_char(cstr_p, cstr_end_p, ch);
+      run_length = size_t(match_p - cstr_p);
+      ::memmove(rewrite_p, cstr_p, run_length);
+      rewrite_p += run_length;
+      cstr_p     = match_p;
       }
 
-    *rewrite_p            = '\0';
-    remove_count          = m_str_ref_p->m_length - length;
-    m_str_ref_p->m_length = length;
+    if (remove_count)
+      {
+      // Characters following end_pos and null terminator
+      ::memmove(rewrite_p, cstr_end_p, size_t(m_str_ref_p->m_length - end_pos));
+      m_str_ref_p->m_length -= remove_count;
+      }
     }
 
   return remove_count;
@@ -2319,14 +2652,10 @@ uint32_t AString::replace_all(
     char * cstr_p     = m_str_ref_p->m_cstr_p;
     char * cstr_end_p = cstr_p + length;
 
-    while (cstr_p < cstr_end_p)
+    while ((cstr_p = const_cast<char *>(scan_char(cstr_p, cstr_end_p, old_ch))) < cstr_end_p)
       {
-      if (*cstr_p == old_ch)
-        {
-        *cstr_p = new_ch;
-        count++;
-        }
-
+      *cstr_p = new_ch;
+      count++;
       cstr_p++;
       }
     }
@@ -2869,9 +3198,6 @@ uint32_t AString::count(
   uint32_t * last_counted_p // = nullptr
   ) const
   {
-  // $Revisit - CReis [Efficiency] This should be faster than repeatedly calling memchr() - profile.
-  // It could be rewritten using inline assembly.
-
   // Ensure not empty
   if (m_str_ref_p->m_length == 0u)
     {
@@ -2887,20 +3213,9 @@ uint32_t AString::count(
     bounds_check(start_pos, end_pos, "count");
   #endif
 
-  uint32_t num_count    = 0u;
-  char *   cstr_start_p = m_str_ref_p->m_cstr_p;
-  char *   cstr_count_p = cstr_start_p + start_pos;
-  char *   cstr_p       = cstr_count_p;
-  char *   cstr_end_p   = cstr_start_p + end_pos;
-
-  for (; cstr_p <= cstr_end_p; cstr_p++)
-    {
-    if (*cstr_p == ch)
-      {
-      cstr_count_p = cstr_p;
-      num_count++;
-      }
-    }
+  const char * cstr_start_p = m_str_ref_p->m_cstr_p;
+  const char * cstr_count_p = cstr_start_p + start_pos;
+  uint32_t     num_count    = scan_count_char(cstr_count_p, cstr_start_p + end_pos + 1u, ch, &cstr_count_p);
 
   if (last_counted_p)
     {
@@ -3007,9 +3322,6 @@ bool AString::find(
   uint32_t   end_pos     // = ALength_remainder
   ) const
   {
-  // $Revisit - CReis [Efficiency] This should be faster than repeatedly calling memchr() - profile.
-  // It could be rewritten using inline assembly.
-
   if (m_str_ref_p->m_length)  // if not empty
     {
     if (end_pos == ALength_remainder)
@@ -3021,26 +3333,22 @@ bool AString::find(
       bounds_check(start_pos, end_pos, instance, "find");
     #endif
 
-    char * cstr_p     = m_str_ref_p->m_cstr_p + start_pos;
-    char * cstr_end_p = m_str_ref_p->m_cstr_p + end_pos;
+    const char * cstr_p     = m_str_ref_p->m_cstr_p + start_pos;
+    const char * cstr_end_p = m_str_ref_p->m_cstr_p + end_pos + 1u;
 
-    while (cstr_p <= cstr_end_p)
+    while ((cstr_p = scan_char(cstr_p, cstr_end_p, ch)) < cstr_end_p)  // Found one
       {
-      if (*cstr_p == ch)     // Found one
+      if (instance == 1u)  // Found it!
         {
-        if (instance == 1u)  // Found it!
+        if (find_pos_p)
           {
-          if (find_pos_p)
-            {
-            *find_pos_p = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
-            }
-
-          return true;
+          *find_pos_p = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
           }
 
-        instance--;
+        return true;
         }
 
+      instance--;
       cstr_p++;
       }
     }
@@ -3246,10 +3554,8 @@ bool AString::find2(
 //              if (str.find(sub_str, 2))  // if 2nd "hello" substring is found
 //                do_something();
 // See:         find(bm), count(), get()
-// Notes:       [Efficiency] This method should be faster than calling strstr() - profile.
-//              The case insensitive routine could probably be made more efficient - via
-//              a lowercase table and/or only converting the characters once in temporary
-//              C-String buffers.
+// Notes:       Candidate positions are found a block of characters at a time by
+//              scan_substr() / scan_isubstr().
 // Author(s):    Conan Reis
 bool AString::find(
   const AString & str,
@@ -3271,80 +3577,53 @@ bool AString::find(
       bounds_check(start_pos, end_pos, instance, "find");
     #endif
 
-    char * match_p;
-    char * find_p;
-    char * cstr_p       = m_str_ref_p->m_cstr_p + start_pos;
-    char * cstr_end_p   = m_str_ref_p->m_cstr_p + end_pos - str.m_str_ref_p->m_length + 1u;  // won't match if less than str left
-    char * find_start_p = str.m_str_ref_p->m_cstr_p;
-    char * find_end_p   = find_start_p + str.m_str_ref_p->m_length;
+    uint32_t     str_length = str.m_str_ref_p->m_length;
+    const char * find_p     = str.m_str_ref_p->m_cstr_p;
+    const char * cstr_p     = m_str_ref_p->m_cstr_p + start_pos;
 
-    if (case_check == AStrCase_sensitive)  // Case sensitive
+    // Won't match if less than str left
+    if ((start_pos + str_length) > (end_pos + 1u))
       {
-      while (cstr_p <= cstr_end_p)
-        {
-        match_p = cstr_p;
-        find_p  = find_start_p;
+      return false;
+      }
 
-        while ((*match_p == *find_p) && (find_p < find_end_p))    //  Note: Okay to check end condition (find_p < find_end_p) second because if >= it will point to null terminator i.e. still valid memory in first part of condition.
-          {
-          find_p++;
-          match_p++;
-          }
+    if (str_length == 0u)
+      {
+      if (find_pos_p)
+        {
+        *find_pos_p = start_pos;
+        }
 
-        if (find_p == find_end_p)  // Found one
-          {
-          if (instance == 1u)      // Found it!
-            {
-            if (find_pos_p)
-              {
-              *find_pos_p = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
-              }
+      return true;
+      }
 
-            return true;
-            }
+    const char * cstr_end_p = m_str_ref_p->m_cstr_p + end_pos + 1u - str_length;  // Last possible match
+    const char * match_p;
 
-          instance--;
-          cstr_p = match_p;
-          }
-        else
-          {
-          cstr_p++;
-          }
-        }
-      }
-    else  // Ignore case
+    while (cstr_p <= cstr_end_p)
       {
-      while (cstr_p <= cstr_end_p)
+      match_p = (case_check == AStrCase_sensitive)
+        ? scan_substr(cstr_p, cstr_end_p, find_p, str_length)
+        : scan_isubstr(cstr_p, cstr_end_p, find_p, str_length);
+
+      if (match_p == nullptr)
         {
-        match_p = cstr_p;
-        find_p  = find_start_p;
+        break;
+        }
 
-        while (!compare_insensitive(*match_p, *find_p) && (find_p < find_end_p))  //  Note: Okay to check end condition (find_p < find_end_p) second because if >= it will point to null terminator i.e. still valid memory in first part of condition.
+      if (instance == 1u)  // Found it!
+        {
+        if (find_pos_p)
           {
-          find_p++;
-          match_p++;
+          *find_pos_p = uint32_t(match_p - m_str_ref_p->m_cstr_p);
           }
 
-        if (find_p == find_end_p)  // Found one
-          {
-          if (instance == 1u)      // Found it!
-            {
-            if (find_pos_p)
-              {
-              *find_pos_p = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
-              }
-
-            return true;
-            }
-
-          instance--;
-          cstr_p = match_p;
-          }
-        else
-          {
-          cstr_p++;
-          }
+        return true;
         }
+
+      // Matches do not overlap
+      instance--;
+      cstr_p = match_p + str_length;
       }
     }
 
@@ -4021,9 +4300,6 @@ bool AString::find_reverse(
   uint32_t   end_pos     // = ALength_remainder
   ) const
   {
-  // $Revisit - CReis [Efficiency] This should be faster than repeatedly calling memchr() - profile.
-  // It could be rewritten using inline assembly.
-
   if (m_str_ref_p->m_length)  // if not empty
     {
     if (end_pos == ALength_remainder)
@@ -4035,27 +4311,22 @@ bool AString::find_reverse(
       bounds_check(start_pos, end_pos, instance, "find_reverse");
     #endif
 
-    char * cstr_p     = m_str_ref_p->m_cstr_p + start_pos;
-    char * cstr_end_p = m_str_ref_p->m_cstr_p + end_pos;
+    const char * cstr_p     = m_str_ref_p->m_cstr_p + start_pos;
+    const char * cstr_end_p = m_str_ref_p->m_cstr_p + end_pos + 1u;
 
-    while (cstr_p <= cstr_end_p)
+    while ((cstr_end_p = scan_char_reverse(cstr_p, cstr_end_p, ch)) != nullptr)  // Found one
       {
-      if (*cstr_end_p == ch)     // Found one
+      if (instance == 1u)  // Found it!
         {
-        if (instance == 1u)  // Found it!
+        if (find_pos_p)
           {
-          if (find_pos_p)
-            {
-            *find_pos_p = uint32_t(cstr_end_p - m_str_ref_p->m_cstr_p);
-            }
-
-          return true;
+          *find_pos_p = uint32_t(cstr_end_p - m_str_ref_p->m_cstr_p);
           }
 
-        instance--;
+        return true;
         }
 
-      cstr_end_p--;
+      instance--;
       }
     }
 
@@ -89,12 +89,25 @@ ASymbolTable::ASymbolTable(
   bool sharing_symbols, // = false
   uint32_t initial_size     // = 0
   ) :
+#if defined(A_SYMBOL_TABLE_HASH)
+  m_sym_refs((const ASymbolRef **)nullptr, 0u, initial_size),
+  m_slots_pp(nullptr),
+  m_slot_mask(0u),
+#else
   m_sym_refs((const ASymbolRef **)nullptr, 0u, initial_size, true),
+#endif
   m_sharing(sharing_symbols)
   {
   // This ensures that the symbol reference pool is allocated and that it is feed *after*
   // the destructor of this symbol table.
   ASymbolRef::get_pool();
+
+  #if defined(A_SYMBOL_TABLE_HASH)
+    if (initial_size)
+      {
+      ensure_slots(initial_size);
+      }
+  #endif
   }
 
 //---------------------------------------------------------------------------------------
@@ -103,6 +116,13 @@ ASymbolTable::ASymbolTable(
 ASymbolTable::~ASymbolTable()
   {
   empty();
+
+  #if defined(A_SYMBOL_TABLE_HASH)
+    if (m_slots_pp)
+      {
+      AgogCore::get_app_info()->free(m_slots_pp);
+      }
+  #endif
   }
 
 //---------------------------------------------------------------------------------------
@@ -130,11 +150,193 @@ void ASymbolTable::empty()
       }
 
     m_sym_refs.empty();
+
+    #if defined(A_SYMBOL_TABLE_HASH)
+      empty_slots();
+    #endif
+    }
+  }
+
+#if defined(A_SYMBOL_TABLE_HASH)
+
+//---------------------------------------------------------------------------------------
+// Clears all the hash slots without changing the slot count.
+void ASymbolTable::empty_slots()
+  {
+  if (m_slots_pp)
+    {
+    ::memset(m_slots_pp, 0, (m_slot_mask + 1u) * sizeof(ASymbolRef *));
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Ensures that there are enough hash slots to store the specified number of symbols
+// while staying no more than 3/4 full - rehashing any existing symbols if the slot count
+// needs to grow.
+// Arg         sym_count - number of symbols that need to fit
+void ASymbolTable::ensure_slots(uint32_t sym_count)
+  {
+  uint32_t slot_count = m_slot_mask ? (m_slot_mask + 1u) : 0u;
+
+  if ((sym_count * 4u) <= (slot_count * 3u))
+    {
+    return;
+    }
+
+  if (slot_count < Slots_count_min)
+    {
+    slot_count = Slots_count_min;
+    }
+
+  while ((sym_count * 4u) > (slot_count * 3u))
+    {
+    slot_count <<= 1u;
+    }
+
+  if (m_slots_pp)
+    {
+    AgogCore::get_app_info()->free(m_slots_pp);
+    }
+
+  m_slots_pp  = static_cast<ASymbolRef **>(AgogCore::get_app_info()->malloc(
+    slot_count * sizeof(ASymbolRef *), "ASymbolTable.slots"));
+  m_slot_mask = slot_count - 1u;
+  empty_slots();
+
+  // Rehash existing symbols
+  ASymbolRef ** syms_pp     = m_sym_refs.get_array();
+  ASymbolRef ** syms_end_pp = syms_pp + m_sym_refs.get_length();
+  uint32_t      slot;
+
+  for (; syms_pp < syms_end_pp; syms_pp++)
+    {
+    slot = (*syms_pp)->m_uid & m_slot_mask;
+
+    while (m_slots_pp[slot])
+      {
+      slot = (slot + 1u) & m_slot_mask;
+      }
+
+    m_slots_pp[slot] = *syms_pp;
     }
   }
 
 //---------------------------------------------------------------------------------------
-// Determines if the symbol order and symbol ids are valid.
+// Adds symbol reference to this table.
+// Notes:      Assumes that a symbol with the same id is not already in this table.
+void ASymbolTable::insert(ASymbolRef * sym_ref_p)
+  {
+  // Grow before appending - growing rehashes everything already in m_sym_refs so the new
+  // symbol would otherwise be placed twice
+  ensure_slots(m_sym_refs.get_length() + 1u);
+  m_sym_refs.append(*sym_ref_p);
+
+  uint32_t slot = sym_ref_p->m_uid & m_slot_mask;
+
+  while (m_slots_pp[slot])
+    {
+    slot = (slot + 1u) & m_slot_mask;
+    }
+
+  m_slots_pp[slot] = sym_ref_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes symbol with the specified id from this table (if present) - does not delete it.
+// Notes:      Uses backward shift deletion so no tombstones are needed and the probe
+//             sequences stay short.  Removing from m_sym_refs is linear though this is
+//             only done for symbols of temporary (auto-parse) tables.
+void ASymbolTable::remove(uint32_t sym_id)
+  {
+  if (m_slot_mask == 0u)
+    {
+    return;
+    }
+
+  ASymbolRef * sym_ref_p;
+  uint32_t     slot = sym_id & m_slot_mask;
+
+  while (true)
+    {
+    sym_ref_p = m_slots_pp[slot];
+
+    if (sym_ref_p == nullptr)
+      {
+      // Not present
+      return;
+      }
+
+    if (sym_ref_p->m_uid == sym_id)
+      {
+      break;
+      }
+
+    slot = (slot + 1u) & m_slot_mask;
+    }
+
+  // Shift back any following symbols in the same probe run that would no longer be
+  // reachable from their home slot.
+  uint32_t     home;
+  uint32_t     next = slot;
+  ASymbolRef * next_ref_p;
+
+  while (true)
+    {
+    next       = (next + 1u) & m_slot_mask;
+    next_ref_p = m_slots_pp[next];
+
+    if (next_ref_p == nullptr)
+      {
+      break;
+      }
+
+    home = next_ref_p->m_uid & m_slot_mask;
+
+    // Move if its home slot is not cyclically within (slot, next]
+    if (((next - home) & m_slot_mask) >= ((next - slot) & m_slot_mask))
+      {
+      m_slots_pp[slot] = next_ref_p;
+      slot = next;
+      }
+    }
+
+  m_slots_pp[slot] = nullptr;
+
+  // Remove from symbol array - order does not matter so swap in last symbol
+  uint32_t      length  = m_sym_refs.get_length();
+  ASymbolRef ** syms_pp = m_sym_refs.get_array();
+  uint32_t      idx     = 0u;
+
+  while (syms_pp[idx] != sym_ref_p)
+    {
+    idx++;
+    }
+
+  syms_pp[idx] = syms_pp[length - 1u];
+  m_sym_refs.set_length_unsafe(length - 1u);
+  }
+
+#else  // A_SYMBOL_TABLE_HASH
+
+//---------------------------------------------------------------------------------------
+// Adds symbol reference to this table in symbol id order.
+// Notes:      Assumes that a symbol with the same id is not already in this table.
+void ASymbolTable::insert(ASymbolRef * sym_ref_p)
+  {
+  m_sym_refs.append(*sym_ref_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes symbol with the specified id from this table (if present) - does not delete it.
+void ASymbolTable::remove(uint32_t sym_id)
+  {
+  m_sym_refs.remove(sym_id, AMatch_first_found);
+  }
+
+#endif  // A_SYMBOL_TABLE_HASH
+
+//---------------------------------------------------------------------------------------
+// Determines if the symbol order (or hash index) and symbol ids are valid.
 // Notes:      This is a test function that should hopefully never need to be called.
 //             It was written to discover a potential memory stomp bug.
 // Author(s):   Conan Reis
@@ -150,7 +352,10 @@ void ASymbolTable::validate() const
     uint32_t     id;
     uint32_t     sym_id;
     ASymbolRef * sym_p;
-    ASymbolRef * prev_sym_p = nullptr;
+
+    #if !defined(A_SYMBOL_TABLE_HASH)
+      ASymbolRef * prev_sym_p = nullptr;
+    #endif
 
     for (; syms_pp < syms_end_pp; syms_pp++)
       {
@@ -164,16 +369,24 @@ void ASymbolTable::validate() const
           "Stored symbol '%s'#%u should have id #%u!",
           sym_p->m_str_ref_p->m_cstr_p, sym_id, id));
 
-      if (prev_sym_p)
-        {
-	    A_VERIFYX(
-          (prev_sym_p->m_uid < sym_id),
-		  a_cstr_format(
-            "Symbol ids '%s'#%u and '%s'#%u are not in proper sequence!",
-            prev_sym_p->m_str_ref_p->m_cstr_p, prev_sym_p->m_uid, sym_p->m_str_ref_p->m_cstr_p, sym_id));
-        }
+      #if defined(A_SYMBOL_TABLE_HASH)
+        A_VERIFYX(
+          find(sym_id) == sym_p,
+          a_cstr_format(
+            "Symbol '%s'#%u is not properly hashed!",
+            sym_p->m_str_ref_p->m_cstr_p, sym_id));
+      #else
+        if (prev_sym_p)
+          {
+          A_VERIFYX(
+            (prev_sym_p->m_uid < sym_id),
+            a_cstr_format(
+              "Symbol ids '%s'#%u and '%s'#%u are not in proper sequence!",
+              prev_sym_p->m_str_ref_p->m_cstr_p, prev_sym_p->m_uid, sym_p->m_str_ref_p->m_cstr_p, sym_id));
+          }
 
-      prev_sym_p = sym_p;
+        prev_sym_p = sym_p;
+      #endif
       }
     }
   }
@@ -220,10 +433,20 @@ void ASymbolTable::as_binary(void ** binary_pp) const
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Repeating in symbol id order
 
+  #if defined(A_SYMBOL_TABLE_HASH)
+    // Symbols are stored in the order they were added so sort a copy so the binary stays
+    // deterministic.
+    APArrayLogical<ASymbolRef, uint32_t> sorted_syms(m_sym_refs);
+
+    sorted_syms.sort();
+  #else
+    const APSortedLogical<ASymbolRef, uint32_t> & sorted_syms = m_sym_refs;
+  #endif
+
   uint8_t           str_len;
   ASymbolRef *  sym_ref_p;
   AStringRef *  str_ref_p;
-  ASymbolRef ** syms_pp     = m_sym_refs.get_array(); 
+  ASymbolRef ** syms_pp     = sorted_syms.get_array(); 
   ASymbolRef ** syms_end_pp = syms_pp + length;
 
   for (; syms_pp < syms_end_pp; syms_pp++)
@@ -283,6 +506,10 @@ void ASymbolTable::assign_binary(const void ** binary_pp)
 
   m_sym_refs.ensure_size_empty(length);
 
+  #if defined(A_SYMBOL_TABLE_HASH)
+    ensure_slots(length);
+  #endif
+
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Repeating in symbol id order
@@ -290,11 +517,7 @@ void ASymbolTable::assign_binary(const void ** binary_pp)
   uint32_t sym_id;
   uint32_t str_len;
 
-  ASymbolRef ** syms_pp     = m_sym_refs.get_array(); 
-  ASymbolRef ** syms_end_pp = syms_pp + length;
-
-  // Determine total data length
-  for (; syms_pp < syms_end_pp; syms_pp++)
+  for (; length; length--)
     {
     // 4 bytes - symbol id
     sym_id = A_BYTE_STREAM_UI32_INC(binary_pp);
@@ -303,9 +526,9 @@ void ASymbolTable::assign_binary(const void ** binary_pp)
     str_len = A_BYTE_STREAM_UI8_INC(binary_pp);
 
     // n bytes - string
-    *syms_pp = ASymbolRef::pool_new(
+    insert(ASymbolRef::pool_new(
       AStringRef::pool_new_copy((const char *)*binary_pp, str_len),
-      sym_id);
+      sym_id));
     (*(uint8_t **)binary_pp) += str_len;
     }
   }
@@ -342,6 +565,10 @@ void ASymbolTable::merge_binary(const void ** binary_pp)
   // Assume that there will be no overlap
   m_sym_refs.ensure_size(init_length + length);
 
+  #if defined(A_SYMBOL_TABLE_HASH)
+    ensure_slots(init_length + length);
+  #endif
+
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Repeating in symbol id order
@@ -400,6 +627,12 @@ void ASymbolTable::remove_unreferenced()
     if (remomve_count)
       {
       m_sym_refs.remove_all_last(remomve_count);
+
+      #if defined(A_SYMBOL_TABLE_HASH)
+        // Rebuild hash index from remaining symbols
+        m_slot_mask = 0u;
+        ensure_slots(m_sym_refs.get_length());
+      #endif
       }
     }
   }
@@ -433,17 +666,15 @@ void ASymbolTable::append_shared(const ASymbol & shared_symbol)
 
   if (sym_id != ASymbol_id_null)
     {
-    #if defined(A_SYMBOL_REF_LINK)
-      m_sym_refs.append_absent(*shared_symbol.m_ref_p);
-    #else
-      uint32_t insert_pos;
-      
-      if (!m_sym_refs.find(sym_id, AMatch_first_found, &insert_pos))
-        {
+    if (find(sym_id) == nullptr)
+      {
+      #if defined(A_SYMBOL_REF_LINK)
+        insert(shared_symbol.m_ref_p);
+      #else
         // Assuming symbol exists in main table.
-        m_sym_refs.insert(*ms_main_p->m_sym_refs.get(sym_id), insert_pos);
-        }
-    #endif
+        insert(ms_main_p->find(sym_id));
+      #endif
+      }
     }
   }
 
@@ -457,7 +688,7 @@ ASymbol ASymbolTable::translate_str(const AString & str) const
   if (str.is_filled())
     {
     uint32_t     sym_id    = ASYMBOL_STR_TO_ID(str);
-    ASymbolRef * sym_ref_p = m_sym_refs.get(sym_id);
+    ASymbolRef * sym_ref_p = find(sym_id);
 
     if (sym_ref_p)
       {
@@ -481,7 +712,7 @@ AString ASymbolTable::translate_id(uint32_t sym_id) const
     return AString::ms_empty;
     }
 
-  ASymbolRef * sym_ref_p = m_sym_refs.get(sym_id);
+  ASymbolRef * sym_ref_p = find(sym_id);
 
   if (sym_ref_p)
     {
@@ -512,7 +743,7 @@ bool ASymbolTable::translate_known_id(
     return true;
     }
 
-  ASymbolRef * sym_ref_p = m_sym_refs.get(sym_id);
+  ASymbolRef * sym_ref_p = find(sym_id);
 
   if (sym_ref_p)
     {
@@ -652,8 +883,7 @@ ASymbolRef * ASymbolTable::symbol_reference(uint32_t sym_id, const AString & str
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Use existing symbol reference if it is already registered.
 
-  uint32_t     idx;
-  ASymbolRef * sym_ref_p = m_sym_refs.get(sym_id, AMatch_first_found, &idx);
+  ASymbolRef * sym_ref_p = find(sym_id);
 
   if (sym_ref_p)
     {
@@ -684,7 +914,7 @@ ASymbolRef * ASymbolTable::symbol_reference(uint32_t sym_id, const AString & str
     ? ASymbolRef::pool_new(str.m_str_ref_p, sym_id)
     : ASymbolRef::pool_new(AStringRef::pool_new_copy(str.m_str_ref_p->m_cstr_p, str.m_str_ref_p->m_length), sym_id);
 
-  m_sym_refs.insert(*sym_ref_p, idx);
+  insert(sym_ref_p);
 
   return sym_ref_p;
   }
@@ -720,8 +950,7 @@ ASymbolRef * ASymbolTable::symbol_reference(uint32_t sym_id, const char * cstr_p
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Use existing symbol reference if it is already registered.
 
-  uint32_t     idx;
-  ASymbolRef * sym_ref_p = m_sym_refs.get(sym_id, 1u, &idx);
+  ASymbolRef * sym_ref_p = find(sym_id);
 
   if (sym_ref_p)
     {
@@ -754,7 +983,7 @@ ASymbolRef * ASymbolTable::symbol_reference(uint32_t sym_id, const char * cstr_p
 
   sym_ref_p = ASymbolRef::pool_new(str_ref_p, sym_id);
 
-  m_sym_refs.insert(*sym_ref_p, idx);
+  insert(sym_ref_p);
 
   return sym_ref_p;
   }
@@ -796,7 +1025,7 @@ void ASymbolTable::track_auto_parse_term()
   for (uint32_t i = 0; i < length; i++)
     {
     ASymbolRef * sym_ref = ms_auto_parse_syms_p->m_sym_refs.get_at(i);
-    ms_main_p->m_sym_refs.remove(sym_ref->m_uid, AMatch_first_found);
+    ms_main_p->remove(sym_ref->m_uid);
 
     //A_DPRINT(A_SOURCE_STR "Removing symbol = %ld\n", sym_ref->m_uid);
     }
@@ -50,6 +50,12 @@
 //    uint32_t hash_modelb = AChecksum::generate_crc32_cstr("_B", base_hash);    Same as "ModelName_B"
 //    uint32_t hash_modelc = AChecksum::generate_crc32_cstr("_C", base_hash);    Same as "ModelName_C"
 //
+// CRC32 checksums of string literals can be generated at compile time and are identical
+// to the run-time versions:
+//
+//    uint32_t crc_const = AChecksum::generate_crc32_literal("Left_Right");   Same as crc_full
+//    uint32_t crc_id    = A_CRC32_LITERAL("Left_Right");  Always evaluated at compile time
+//
 // References:
 //
 //    http://en.wikipedia.org/wiki/Cyclic_redundancy_check
@@ -65,6 +71,15 @@
 #include <AgogCore/AgogCore.hpp>
 
 
+//=======================================================================================
+// Defines
+//=======================================================================================
+
+// Evaluates the CRC32 checksum of a string literal at compile time - even when used as a
+// run-time argument.
+#define A_CRC32_LITERAL(_cstr_literal)  uint32_t(AChecksumConst<AChecksum::generate_crc32_literal(_cstr_literal)>::value)
+
+
 //=======================================================================================
 // Global Structures
 //=======================================================================================
@@ -86,8 +101,54 @@ class A_API AChecksum
     static uint32_t generate_crc32_upper(const AString & str, uint32_t prev_crc = 0);
     static uint32_t generate_crc32_cstr_upper(const char * cstr_p, uint32_t length = ALength_calculate, uint32_t prev_crc = 0);
 
+    // Compile-time versions - prefer the run-time versions for non-constant data since
+    // these process one bit at a time.
+    static constexpr uint32_t generate_crc32_const(const char * cstr_p, uint32_t length, uint32_t prev_crc = 0);
+    template<uint32_t _Size>
+      static constexpr uint32_t generate_crc32_literal(const char (&cstr)[_Size], uint32_t prev_crc = 0)  { return generate_crc32_const(cstr, _Size - 1u, prev_crc); }
+
+  protected:
+
+    // Helpers for generate_crc32_const() - recursive single expressions so they are valid
+    // C++11 constexpr functions (older compilers do not allow loops in constexpr).
+    static constexpr uint32_t crc32_const_bits(uint32_t crc, uint32_t bit_count)  { return bit_count ? crc32_const_bits((crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u))), bit_count - 1u) : crc; }  // The _reversed_ polynomial
+    static constexpr uint32_t crc32_const_bytes(const char * cstr_p, uint32_t length, uint32_t crc)  { return length ? crc32_const_bytes(cstr_p + 1, length - 1u, crc32_const_bits(crc ^ uint8_t(*cstr_p), 8u)) : crc; }
+
+  public:
+
     static uint64_t generate_crc64(const void * data_p, uint32_t data_num_bytes, uint64_t prev_crc = 0);
     static uint64_t generate_crc64(const AString & str, uint64_t prev_crc = 0);
     static uint64_t generate_crc64_cstr(const char * cstr_p, uint32_t length = ALength_calculate, uint64_t prev_crc = 0);
 
   };
+
+//---------------------------------------------------------------------------------------
+// Used by A_CRC32_LITERAL() to force compile-time evaluation of a checksum
+template<uint32_t _Value>
+struct AChecksumConst
+  {
+  enum : uint32_t { value = _Value };
+  };
+
+
+//=======================================================================================
+// Inline Functions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Creates a checksum via the CRC (cyclic redundancy check) algorithm at compile time.
+// Gives the same result as generate_crc32_cstr() though it works bit by bit rather than
+// using a lookup table.
+// Returns:    Checksum created via the CRC algorithm.
+// Arg         cstr_p - pointer to array of characters (does not need to be null terminated)
+// Arg         length - number of characters to use in 'cstr_p'
+// Arg         prev_crc - previous CRC checksum to iterate on
+// Modifiers:   static
+inline constexpr uint32_t AChecksum::generate_crc32_const(
+  const char * cstr_p,
+  uint32_t     length,
+  uint32_t     prev_crc // = 0
+  )
+  {
+  return ~crc32_const_bytes(cstr_p, length, ~prev_crc);
+  }
@@ -111,6 +111,7 @@
 
   #define ASYMBOL_CSTR_STORE(_sym_id, _cstr_p, _length, _term)  ASymbolTable::ms_main_p->symbol_reference(_sym_id, _cstr_p, _length, _term)
   #define ASYMBOL_CSTR_TO_ID(_cstr_p, _char_count)              AChecksum::generate_crc32_cstr(_cstr_p, _char_count)
+  #define ASYMBOL_LITERAL_TO_ID(_cstr_literal)                  A_CRC32_LITERAL(_cstr_literal)
 
   #ifdef A_SYMBOL_STR_DB_AGOG
     #define ASYMBOL_ID_TO_STR(_sym_id)                          ASymbolTable::ms_main_p->translate_id(_sym_id)
@@ -143,6 +144,18 @@
 #endif
 
 
+//---------------------------------------------------------------------------------------
+// Creates symbol from a string literal - the id is generated at compile time by
+// ASYMBOL_LITERAL_TO_ID() so no hashing or strlen() is done at run-time and the literal
+// is referenced rather than copied.  Without a string database the symbol is just the
+// id so nothing at all is done at run-time.
+#if defined(ASYMBOL_LITERAL_TO_ID)
+  #define ASYMBOL_LITERAL(_cstr_literal)  ASymbol::create_literal(ASYMBOL_LITERAL_TO_ID(_cstr_literal), _cstr_literal, uint32_t(sizeof(_cstr_literal) - 1u))
+#else
+  #define ASYMBOL_LITERAL(_cstr_literal)  ASymbol::create(_cstr_literal, uint32_t(sizeof(_cstr_literal) - 1u), ATerm_long)
+#endif
+
+
 //---------------------------------------------------------------------------------------
 // Constant Symbol Helper Macros - see SkSymbol.hpp for usage examples for these defines.
 
@@ -279,6 +292,9 @@ class A_API ASymbol
     static ASymbol create_existing(const AString & str);
     static ASymbol create_existing(const char * cstr_p, uint32_t length = ALength_calculate);
 
+    // Used by ASYMBOL_LITERAL() - defined in ASymbolTable.hpp
+    static ASymbol create_literal(uint32_t sym_id, const char * cstr_p, uint32_t length);
+
     ASymbol        create_add(const AString & suffix) const;
     ASymbol        create_add(const char * suffix_p, uint32_t length = ALength_calculate) const;
 
@@ -27,6 +27,7 @@
 //=======================================================================================
 
 #include <AgogCore/ASymbol.hpp>
+#include <AgogCore/APArray.hpp>
 #include <AgogCore/APSorted.hpp>
 
 
@@ -34,6 +35,13 @@
 // Defines
 //=======================================================================================
 
+#if defined(A_FULL_SOURCE) && !defined(A_SYMBOL_TABLE_SORTED)
+  // If this is defined symbol tables find symbols through a hash index rather than a
+  // binary search of a sorted array.  This changes the layout of ASymbolTable so it is
+  // only available when AgogCore is built from source rather than linked as a library.
+  #define A_SYMBOL_TABLE_HASH
+#endif
+
 
 //=======================================================================================
 // Global Structures
@@ -91,7 +99,7 @@ class A_API ASymbolTable
     bool    translate_known_id(uint32_t sym_id, AString * str_p) const;
     ASymbol translate_str(const AString & str) const;
 
-    uint32_t  get_length() { return m_sym_refs.get_length(); }
+    uint32_t  get_length() const { return m_sym_refs.get_length(); }
     void      track_auto_parse_init();
     void      track_auto_parse_term();
 
@@ -110,18 +118,55 @@ class A_API ASymbolTable
 
   protected:
 
-    ASymbolRef * get_symbol(uint32_t id) const;
-    ASymbolRef * symbol_reference(uint32_t sym_id, const AString & str, eATerm term);
-    ASymbolRef * symbol_reference(uint32_t sym_id, const char * cstr_p, uint32_t length, eATerm term);
+  #if defined(A_SYMBOL_TABLE_HASH)
+
+  // Internal Class Methods
+
+    // Initial number of hash slots - must be a power of 2
+    enum { Slots_count_min = 64u };
+
+  #endif
+
+  // Internal Methods
+
+    ASymbolRef *  get_symbol(uint32_t id) const;
+    ASymbolRef *  find(uint32_t sym_id) const;
+    ASymbolRef *  symbol_reference(uint32_t sym_id, const AString & str, eATerm term);
+    ASymbolRef *  symbol_reference(uint32_t sym_id, const char * cstr_p, uint32_t length, eATerm term);
+    void          insert(ASymbolRef * sym_ref_p);
+    void          remove(uint32_t sym_id);
+
+    #if defined(A_SYMBOL_TABLE_HASH)
+      void        ensure_slots(uint32_t sym_count);
+      void        empty_slots();
+    #endif
 
   // Data Members
 
+  #if defined(A_SYMBOL_TABLE_HASH)
+
+    // Symbols (strings and ids) making up this table in the order that they were added.
+    // Use m_slots_pp to look up a symbol by its id.
+    APArrayLogical<ASymbolRef, uint32_t> m_sym_refs;
+
+    // Open addressed hash index (with linear probing) into m_sym_refs keyed on symbol
+    // id.  Since ids are CRC32 values their lower bits are used directly as the hash.
+    // Its slot count is a power of 2 and it is kept no more than 3/4 full.
+    ASymbolRef ** m_slots_pp;
+
+    // Slot count - 1 or 0 if m_slots_pp not yet allocated
+    uint32_t m_slot_mask;
+
+  #else
+
     // Symbols (strings and ids) making up this table.  Sorted in symbol id order.
     // $Revisit - CReis Probably best written as some sort of tree (esp. if there are many
     // symbols created during run-time) rather than a single array - possibly custom to
     // this class.
     APSortedLogical<ASymbolRef, uint32_t> m_sym_refs;
 
+  #endif
+
     // Indicates whether or not the symbol table is sharing ASymbol objects with another
     // ASymbolTable.
     bool m_sharing;
@@ -135,6 +180,49 @@ class A_API ASymbolTable
 // Inline Functions
 //=======================================================================================
 
+//---------------------------------------------------------------------------------------
+// Creates a symbol from a string literal and the id generated for it at compile time -
+// same as ASymbol::create() without the hashing.  Use ASYMBOL_LITERAL() rather than
+// calling this directly so the id is guaranteed to match the literal.
+// Returns:    new symbol
+// Arg         sym_id - id of literal as generated by ASYMBOL_LITERAL_TO_ID()
+// Arg         cstr_p - string literal
+// Arg         length - number of characters in 'cstr_p' excluding the null terminator
+// Modifiers:   static
+inline ASymbol ASymbol::create_literal(
+  uint32_t     sym_id,
+  const char * cstr_p,
+  uint32_t     length
+  )
+  {
+  A_ASSERTX(sym_id == ASYMBOL_CSTR_TO_ID(cstr_p, length), "ASYMBOL_LITERAL() id does not match the id of its string!");
+
+  #if defined(A_SYMBOL_REF_LINK)
+
+    //  If the auto-parse symbol table is defined, make a copy any symbol not already in
+    //  in the main table so it can be removed once the auto-parse completes.
+    if (ASymbolTable::ms_auto_parse_syms_p)
+      {
+      ASymbolRef * sym_ref = ASymbolTable::ms_main_p->get_symbol(sym_id);
+      if (!sym_ref)
+        {
+        ASymbolTable::ms_auto_parse_syms_p->symbol_reference(sym_id, cstr_p, length, ATerm_long);
+        }
+      else
+        {
+        return sym_ref;
+        }
+      }
+
+    return ASymbolTable::ms_main_p->symbol_reference(sym_id, cstr_p, length, ATerm_long);
+  #elif defined(A_SYMBOL_STR_DB)
+    ASYMBOL_CSTR_STORE(sym_id, cstr_p, length, ATerm_long);
+    return sym_id;
+  #else
+    return sym_id;
+  #endif
+  }
+
 #ifndef A_INL_IN_CPP
   #include <AgogCore/ASymbolTable.inl>
 #endif
@@ -41,7 +41,7 @@
 // Author(s):   Conan Reis
 A_INLINE bool ASymbolTable::is_registered(uint32_t sym_id) const
   {
-  return (sym_id == ASymbol_id_null) || m_sym_refs.find(sym_id);
+  return (sym_id == ASymbol_id_null) || (find(sym_id) != nullptr);
   }
 
 //---------------------------------------------------------------------------------------
@@ -53,7 +53,7 @@ A_INLINE bool ASymbolTable::is_registered(uint32_t sym_id) const
 A_INLINE ASymbolRef * ASymbolTable::get_symbol(uint32_t id) const
   {
   return (id != ASymbol_id_null)
-    ? m_sym_refs.get(id)
+    ? find(id)
   #if defined(A_SYMBOL_REF_LINK)
     : ASymbol::ms_null.m_ref_p;
   #else
@@ -62,8 +62,45 @@ A_INLINE ASymbolRef * ASymbolTable::get_symbol(uint32_t id) const
   }
 
 
+//---------------------------------------------------------------------------------------
+// Looks up symbol reference in the hash index by symbol id.
+// Returns:    ASymbolRef with matching id or nullptr
+// Arg         sym_id - symbol id to lookup - must not be ASymbol_id_null
+A_INLINE ASymbolRef * ASymbolTable::find(uint32_t sym_id) const
+  {
+  #if defined(A_SYMBOL_TABLE_HASH)
+
+    if (m_slot_mask == 0u)
+      {
+      return nullptr;
+      }
+
+    ASymbolRef * sym_ref_p;
+    uint32_t     slot = sym_id & m_slot_mask;
+
+    while ((sym_ref_p = m_slots_pp[slot]) != nullptr)
+      {
+      if (sym_ref_p->m_uid == sym_id)
+        {
+        return sym_ref_p;
+        }
+
+      slot = (slot + 1u) & m_slot_mask;
+      }
+
+    return nullptr;
+
+  #else
+
+    return m_sym_refs.get(sym_id);
+
+  #endif
+  }
+
 //---------------------------------------------------------------------------------------
 //  Returns a symbol ref at the given index, null if table empty or index out-of-range.
+//  Symbols are indexed in symbol id order - unless A_SYMBOL_TABLE_HASH is defined in
+//  which case they are indexed in the order that they were added to the table.
 //  
 //  Returns:    ASymbolRef or null symbol ref.
 //  Arg         index - symbol ref index to return
@@ -1119,6 +1119,7 @@ FString FSkookumScriptGenerator::generate_event_binding_code(const FString & cla
   generated_code += TEXT(
     ")\n"
     "        {\n"
+    "        if (!is_accepting_event()) return;\n"
     "        EventInfo * event_p = alloc_event();\n");
   int32 param_index = 0;
   if (binding.m_property_p->SignatureFunction->Children)
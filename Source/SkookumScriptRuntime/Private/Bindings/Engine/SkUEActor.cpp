@@ -30,6 +30,8 @@
 #include "../SkUERuntime.hpp"
 #include "../SkUEUtils.hpp"
 #include "UObjectHash.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
 #include <SkUEWorld.generated.hpp>
 
 #include <SkookumScript/SkList.hpp>
@@ -59,39 +61,43 @@ namespace SkUEActor_Impl
   //---------------------------------------------------------------------------------------
   // Find actor of given name (returns nullptr if not found)
   // instance_pp returns a reffed SkInstance for the actor if one was found
+  // Actor names are unique within their level so rather than scanning every actor of the
+  // class, look the name up in the UObject hash of each level in the world.
   static AActor * find_named(const FName & name, SkInvokedMethod * scope_p, SkClass ** sk_class_pp, UClass ** ue_class_pp, SkInstance ** instance_pp)
     {
-    // Get actor array
-    TArray<UObject*> object_array;
-    SkClass * sk_super_class_p;
+    UClass * ue_class_p;
     SkClass * sk_class_p = ((SkMetaClass *)scope_p->get_topmost_scope())->get_class_info();
-    UClass * ue_class_p = get_actor_super_class_array(sk_class_p, &object_array, &sk_super_class_p);
+    SkClass * sk_super_class_p = SkUEClassBindingHelper::find_most_derived_super_class_known_to_ue(sk_class_p, &ue_class_p);
 
     // Find our actor
     UWorld * world_p = SkUEClassBindingHelper::get_world();
     AActor * actor_p = nullptr;
     SkInstance * instance_p = nullptr;
-    for (UObject ** RESTRICT obj_pp = object_array.GetData(), **RESTRICT end_pp = obj_pp + object_array.Num(); obj_pp != end_pp; ++obj_pp)
+    if (ue_class_p && world_p)
       {
-      if ((*obj_pp)->GetWorld() == world_p && (*obj_pp)->GetFName() == name)
+      for (ULevel * level_p : world_p->GetLevels())
         {
-        actor_p = static_cast<AActor *>(*obj_pp);
-        if (sk_super_class_p == sk_class_p)
+        AActor * level_actor_p = level_p ? static_cast<AActor *>(StaticFindObjectFast(ue_class_p, level_p, name)) : nullptr;
+        if (level_actor_p)
           {
-          break;
-          }
-        SkInstance * embedded_instance_p = SkUEClassBindingHelper::get_embedded_instance(actor_p, sk_super_class_p);
-        if (embedded_instance_p)
-          {
-          SkClass * instance_class_p = embedded_instance_p->get_class();
-          if (instance_class_p->is_class(*sk_class_p))
+          actor_p = level_actor_p;
+          if (sk_super_class_p == sk_class_p)
             {
-            sk_class_p = instance_class_p;
-            ue_class_p = actor_p->GetClass();
-            instance_p = embedded_instance_p;
-            instance_p->reference();
             break;
             }
+          SkInstance * embedded_instance_p = SkUEClassBindingHelper::get_embedded_instance(actor_p, sk_super_class_p);
+          if (embedded_instance_p)
+            {
+            SkClass * instance_class_p = embedded_instance_p->get_class();
+            if (instance_class_p->is_class(*sk_class_p))
+              {
+              sk_class_p = instance_class_p;
+              ue_class_p = actor_p->GetClass();
+              instance_p = embedded_instance_p;
+              instance_p->reference();
+              break;
+              }
+            }
           }
         }
       }
@@ -0,0 +1,739 @@
+//=======================================================================================
+// Copyright (c) 2001-2017 Agog Labs Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=======================================================================================
+
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+//
+// Micro benchmarks of AgogCore data structures, allocators and script bindings - run
+// from the console (sk.Bench.*) and compare the printed timings between builds
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/UnrealMemory.h"
+#include "Math/RandomStream.h"
+#include "UObject/UObjectIterator.h"
+
+#include "SkUEClassBinding.hpp"
+#include "SkUEReflectionManager.hpp"
+#include "SkUERuntime.hpp"
+#include "SkUESlabAllocator.hpp"
+#include "VectorMath/SkTransform.hpp"
+#include "VectorMath/SkVector3.hpp"
+
+#include <AgogCore/ADebug.hpp>
+#include <AgogCore/AString.hpp>
+#include <AgogCore/ASymbolTable.hpp>
+#include <SkookumScript/SkClass.hpp>
+#include <SkookumScript/SkInteger.hpp>
+#include <SkookumScript/SkList.hpp>
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+  {
+
+  //---------------------------------------------------------------------------------------
+  // Allocation churn - keeps a fixed number of small allocations alive and repeatedly
+  // replaces a random one with an allocation of random size, the way string buffers and
+  // array storage come and go while scripts run.  Runs the same sequence through FMemory
+  // and through SkUESlabAllocator.
+  //
+  // Argument: number of allocations (default 4000000)
+  void cmd_bench_alloc(const TArray<FString> & args)
+    {
+    enum { Live_count = 8192 };
+
+    uint32_t alloc_count = uint32_t(FMath::Max(args.Num() ? FCString::Atoi(*args[0]) : 4000000, 1));
+    void *   live[Live_count];
+    double   secs[2];
+
+    for (uint32_t pass = 0u; pass < 2u; pass++)
+      {
+      bool          use_slabs = (pass == 1u);
+      FRandomStream random(1);
+
+      FMemory::Memzero(live, sizeof(live));
+
+      double start_secs = FPlatformTime::Seconds();
+
+      for (uint32_t idx = 0u; idx < alloc_count; idx++)
+        {
+        void ** mem_pp = &live[random.RandHelper(Live_count)];
+        size_t  size   = size_t(16 + random.RandHelper(SkUESlabAllocator::Size_max - 16));
+
+        if (use_slabs)
+          {
+          SkUESlabAllocator::get().deallocate(*mem_pp);
+          *mem_pp = SkUESlabAllocator::get().allocate(size, nullptr);
+          }
+        else
+          {
+          FMemory::Free(*mem_pp);
+          *mem_pp = FMemory::Malloc(size, SkUESlabAllocator::Alignment);
+          }
+        }
+
+      for (void * mem_p : live)
+        {
+        if (use_slabs)
+          {
+          SkUESlabAllocator::get().deallocate(mem_p);
+          }
+        else
+          {
+          FMemory::Free(mem_p);
+          }
+        }
+
+      secs[pass] = FPlatformTime::Seconds() - start_secs;
+      }
+
+    ADebug::print_format(
+      "\nAllocation churn - %u allocations of 16-%u bytes, %u live\n  FMemory: %8.3f ms\n  slabs:   %8.3f ms (%.2fx)\n",
+      alloc_count, uint32_t(SkUESlabAllocator::Size_max), uint32_t(Live_count), secs[0] * 1000.0, secs[1] * 1000.0, secs[0] / FMath::Max(secs[1], 1e-9));
+
+    SkUESlabAllocator::get().print_stats();
+    }
+
+  FAutoConsoleCommand g_cmd_bench_alloc(TEXT("sk.Bench.Alloc"), TEXT("Times small allocation churn through FMemory and the SkookumScript slab allocator. Argument: number of allocations (default 4000000)."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_bench_alloc));
+
+  #if defined(A_SYMBOLTABLE_CLASSES)
+
+  //---------------------------------------------------------------------------------------
+  // Symbol churn - adds many new symbols (in symbol id order which is effectively random
+  // like symbols from FName conversions and SkookumIDE updates) to a symbol table and then
+  // looks each of them up by string.  Also checks that symbols tracked during an auto-parse
+  // are all removed from the main table again.
+  //
+  // Argument: number of symbols (default 50000)
+  void cmd_bench_symbols(const TArray<FString> & args)
+    {
+    uint32_t sym_count = uint32_t(FMath::Max(args.Num() ? FCString::Atoi(*args[0]) : 50000, 2));
+
+    // Symbols are added through merge_binary() which is public and goes through the same
+    // symbol_reference() path as ASymbol::create() - just on a private table
+    TArray<AString> names;
+    TArray<uint8>   binary;
+
+    names.Reserve(sym_count);
+    binary.Reserve(sym_count * 24u);
+
+    auto append_u32 = [&binary](uint32_t value) { binary.Append(reinterpret_cast<const uint8 *>(&value), sizeof(uint32_t)); };
+
+    // First symbol on its own - merging into an empty table would just assign
+    append_u32(1u);
+    for (uint32_t idx = 0u; idx < sym_count; idx++)
+      {
+      AString name(a_str_format("BenchSymbol_%u", idx));
+      uint8   name_length = uint8(name.get_length());
+
+      if (idx == 1u)
+        {
+        append_u32(sym_count - 1u);
+        }
+
+      append_u32(ASYMBOL_CSTR_TO_ID(name.as_cstr(), name_length));
+      binary.Add(name_length);
+      binary.Append(reinterpret_cast<const uint8 *>(name.as_cstr()), name_length);
+      names.Add(name);
+      }
+
+    ASymbolTable table;
+    const void * binary_p = binary.GetData();
+
+    table.merge_binary(&binary_p);
+
+    double start_secs = FPlatformTime::Seconds();
+    table.merge_binary(&binary_p);
+    double insert_secs = FPlatformTime::Seconds() - start_secs;
+
+    uint32_t found_count = 0u;
+
+    start_secs = FPlatformTime::Seconds();
+    for (const AString & name : names)
+      {
+      found_count += !table.translate_str(name).is_null();
+      }
+    double lookup_secs = FPlatformTime::Seconds() - start_secs;
+
+    ADebug::print_format(
+      "\nSymbol churn (%s) - %u symbols\n  insert: %8.3f ms\n  lookup: %8.3f ms (%u found)\n",
+      #if defined(A_SYMBOL_TABLE_HASH)
+        "hash index",
+      #else
+        "sorted array",
+      #endif
+      sym_count, insert_secs * 1000.0, lookup_secs * 1000.0, found_count);
+
+    #if defined(A_SYMBOL_REF_LINK)
+      // Regression check - every symbol created while an auto-parse is tracked (including
+      // those that grow the hash index) must be gone from the main table once it ends
+      ASymbolTable     tracked_syms;
+      TArray<uint32_t> tracked_ids;
+
+      tracked_ids.Reserve(sym_count);
+      tracked_syms.track_auto_parse_init();
+
+      for (uint32_t idx = 0u; idx < sym_count; idx++)
+        {
+        tracked_ids.Add(ASymbol::create(a_str_format("BenchAutoParse_%u", idx), ATerm_short).get_id());
+        }
+
+      tracked_syms.track_auto_parse_term();
+
+      uint32_t stale_count = 0u;
+
+      for (uint32_t sym_id : tracked_ids)
+        {
+        stale_count += ASymbolTable::ms_main_p->is_registered(sym_id);
+        }
+
+      ADebug::print_format("  auto-parse removal: %s (%u of %u still registered)\n", stale_count ? "FAILED" : "ok", stale_count, sym_count);
+    #endif
+    }
+
+  FAutoConsoleCommand g_cmd_bench_symbols(TEXT("sk.Bench.Symbols"), TEXT("Times adding and looking up many new symbols and checks that auto-parse symbols are removed again. Argument: number of symbols (default 50000)."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_bench_symbols));
+
+  #endif  // A_SYMBOLTABLE_CLASSES
+
+  //---------------------------------------------------------------------------------------
+  // Character loops equivalent to the AString scanning kernels when built with
+  // A_STR_NO_SIMD - used as the reference timings and results for sk.Bench.String.
+
+  char bench_fold(char ch)
+    {
+    return ((ch >= 'A') && (ch <= 'Z')) ? char(ch + ('a' - 'A')) : ch;
+    }
+
+  uint32_t bench_ref_find_char(const AString & str, char ch)
+    {
+    const char * cstr_p = str.as_cstr();
+    uint32_t     length = str.get_length();
+    uint32_t     idx    = 0u;
+
+    while ((idx < length) && (cstr_p[idx] != ch))
+      {
+      idx++;
+      }
+
+    return idx;
+    }
+
+  uint32_t bench_ref_count_char(const AString & str, char ch)
+    {
+    const char * cstr_p = str.as_cstr();
+    const char * end_p  = cstr_p + str.get_length();
+    uint32_t     count  = 0u;
+
+    for (; cstr_p < end_p; cstr_p++)
+      {
+      count += (*cstr_p == ch);
+      }
+
+    return count;
+    }
+
+  uint32_t bench_ref_find_str(const AString & str, const AString & sub, eAStrCase case_check)
+    {
+    const char * cstr_p     = str.as_cstr();
+    const char * sub_p      = sub.as_cstr();
+    uint32_t     length     = str.get_length();
+    uint32_t     sub_length = sub.get_length();
+
+    for (uint32_t idx = 0u; idx + sub_length <= length; idx++)
+      {
+      uint32_t sub_idx = 0u;
+
+      if (case_check == AStrCase_sensitive)
+        {
+        while ((sub_idx < sub_length) && (cstr_p[idx + sub_idx] == sub_p[sub_idx]))
+          {
+          sub_idx++;
+          }
+        }
+      else
+        {
+        while ((sub_idx < sub_length) && (bench_fold(cstr_p[idx + sub_idx]) == bench_fold(sub_p[sub_idx])))
+          {
+          sub_idx++;
+          }
+        }
+
+      if (sub_idx == sub_length)
+        {
+        return idx;
+        }
+      }
+
+    return length;
+    }
+
+  uint32_t bench_ref_is_iequal(const AString & lhs, const AString & rhs)
+    {
+    uint32_t length = lhs.get_length();
+
+    if (length != rhs.get_length())
+      {
+      return 0u;
+      }
+
+    const char * lhs_p = lhs.as_cstr();
+    const char * rhs_p = rhs.as_cstr();
+
+    for (uint32_t idx = 0u; idx < length; idx++)
+      {
+      if (bench_fold(lhs_p[idx]) != bench_fold(rhs_p[idx]))
+        {
+        return 0u;
+        }
+      }
+
+    return 1u;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // String scanning - times the AString methods backed by the character scanning kernels
+  // against plain character loops (the A_STR_NO_SIMD code path) on a short and a long
+  // haystack with the searched for characters and substrings at the very end.  Both are
+  // repeated so that the same total number of characters is scanned.
+  //
+  // Note that the kernels live in AgogCore so they are only used when the plugin is built
+  // from full source - with the prebuilt libraries both columns run the character loops.
+  //
+  // Argument: length of the long haystack (default 65536)
+  void cmd_bench_string(const TArray<FString> & args)
+    {
+    enum
+      {
+      Op_find_char,
+      Op_count_char,
+      Op_find_str,
+      Op_ifind_str,
+      Op_is_iequal,
+      Op__count,
+
+      Length_short = 32,
+      Scan_total   = 1 << 26  // Characters scanned per timing
+      };
+
+    static const char * const op_names[Op__count] = { "find(char)", "count(char)", "find(str)", "find(str, ignore)", "is_iequal()" };
+
+    uint32_t lengths[2] = { Length_short, uint32_t(FMath::Max(args.Num() ? FCString::Atoi(*args[0]) : 65536, 16)) };
+    AString  needle("XyZzy");
+
+    for (uint32_t length : lengths)
+      {
+      // Lowercase haystack of 'a'-'p' with the needle - and so every 'y' - at the end
+      FRandomStream random(1);
+      TArray<char>  chars;
+
+      chars.SetNumUninitialized(length);
+      for (char & ch : chars)
+        {
+        ch = char('a' + random.RandHelper(16));
+        }
+      FMemory::Memcpy(chars.GetData() + length - needle.get_length(), needle.as_cstr(), needle.get_length());
+
+      AString  haystack(chars.GetData(), length, false);
+      AString  haystack_upper(haystack);
+      AString  needle_lower(needle);
+      uint32_t repeat_count = FMath::Max(uint32_t(Scan_total) / length, 1u);
+
+      haystack_upper.uppercase();
+      needle_lower.lowercase();
+
+      ADebug::print_format("\nString scanning - %u character haystack x %u\n                      kernels    reference\n", length, repeat_count);
+
+      for (uint32_t op = 0u; op < Op__count; op++)
+        {
+        double   secs[2];
+        uint32_t results[2];
+
+        for (uint32_t pass = 0u; pass < 2u; pass++)
+          {
+          bool     reference = (pass == 1u);
+          uint32_t result    = 0u;
+          double   start_secs = FPlatformTime::Seconds();
+
+          for (uint32_t repeat = 0u; repeat < repeat_count; repeat++)
+            {
+            uint32_t find_pos = length;
+
+            switch (op)
+              {
+              case Op_find_char:
+                if (reference) { find_pos = bench_ref_find_char(haystack, 'y'); }
+                else           { haystack.find('y', 1u, &find_pos); }
+                result += find_pos;
+                break;
+
+              case Op_count_char:
+                result += reference ? bench_ref_count_char(haystack, 'a') : haystack.count('a');
+                break;
+
+              case Op_find_str:
+                if (reference) { find_pos = bench_ref_find_str(haystack, needle, AStrCase_sensitive); }
+                else           { haystack.find(needle, 1u, &find_pos); }
+                result += find_pos;
+                break;
+
+              case Op_ifind_str:
+                if (reference) { find_pos = bench_ref_find_str(haystack, needle_lower, AStrCase_ignore); }
+                else           { haystack.find(needle_lower, 1u, &find_pos, 0u, ALength_remainder, AStrCase_ignore); }
+                result += find_pos;
+                break;
+
+              case Op_is_iequal:
+                result += reference ? bench_ref_is_iequal(haystack, haystack_upper) : uint32_t(haystack.is_iequal(haystack_upper));
+                break;
+              }
+            }
+
+          secs[pass]    = FPlatformTime::Seconds() - start_secs;
+          results[pass] = result;
+          }
+
+        ADebug::print_format(
+          "  %-18s %8.3f ms  %8.3f ms (%.2fx)%s\n",
+          op_names[op], secs[0] * 1000.0, secs[1] * 1000.0, secs[1] / FMath::Max(secs[0], 1e-9), (results[0] == results[1]) ? "" : "  RESULTS DIFFER");
+        }
+      }
+    }
+
+  FAutoConsoleCommand g_cmd_bench_string(TEXT("sk.Bench.String"), TEXT("Times AString character and substring scanning on short and long strings against plain character loops. Argument: length of the long haystack (default 65536)."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_bench_string));
+
+  //---------------------------------------------------------------------------------------
+  // Returns true if the compiled scripts are loaded and bound so script methods can be
+  // called - otherwise prints why a script benchmark cannot run.
+  bool is_script_bench_ready()
+    {
+    SkUERuntime * runtime_p = SkUERuntime::get_singleton();
+
+    if (runtime_p && runtime_p->is_compiled_scripts_bound())
+      {
+      return true;
+      }
+
+    ADebug::print("\nThis benchmark calls script methods - the compiled scripts must be loaded and bound first.\n");
+
+    return false;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Bulk Vector3 ops - times add_assign() and transform_by() called on every item of a
+  // list of vectors against a single call to add_assign_all() and transform_by_all().
+  // Every call goes through method_call() so the per item timings are the cost of
+  // dispatch and argument passing without the interpreter - a script loop is slower still.
+  //
+  // Argument: number of vectors (default 10000)
+  void cmd_bench_vector3(const TArray<FString> & args)
+    {
+    enum { Repeat_count = 100 };
+
+    if (!is_script_bench_ready())
+      {
+      return;
+      }
+
+    uint32_t      vec_count = uint32_t(FMath::Max(args.Num() ? FCString::Atoi(*args[0]) : 10000, 1));
+    FRandomStream random(1);
+
+    SkInstance *     list_p = SkList::new_instance(vec_count);
+    SkInstanceList & list   = list_p->as<SkList>();
+
+    for (uint32_t idx = 0u; idx < vec_count; idx++)
+      {
+      list.append(*SkVector3::new_instance(FVector(random.FRandRange(-1000.0f, 1000.0f), random.FRandRange(-1000.0f, 1000.0f), random.FRandRange(-1000.0f, 1000.0f))), false);
+      }
+
+    SkInstance * vec_p   = SkVector3::new_instance(FVector(0.5f, -0.25f, 0.125f));
+    SkInstance * xform_p = SkTransform::new_instance(FTransform(FRotator(10.0f, 20.0f, 30.0f), FVector(4.0f, 5.0f, 6.0f), FVector(1.0f)));
+    SkMetaClass & vec3_class = SkVector3::get_class()->get_metaclass();
+
+    const ASymbol op_names[2][2] =
+      {
+      { ASymbol::create("add_assign"),   ASymbol::create("add_assign_all") },
+      { ASymbol::create("transform_by"), ASymbol::create("transform_by_all") },
+      };
+    SkInstance *  op_args[2] = { vec_p, xform_p };
+    double        secs[2][2];
+
+    for (uint32_t op = 0u; op < 2u; op++)
+      {
+      SkInstance * arg_p = op_args[op];
+
+      // Per item - transform_by() returns a new vector which is stored back into the item
+      double start_secs = FPlatformTime::Seconds();
+
+      for (uint32_t repeat = 0u; repeat < Repeat_count; repeat++)
+        {
+        for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+          {
+          SkInstance * result_p = nullptr;
+
+          arg_p->reference();
+          (*item_pp)->method_call(op_names[op][0], arg_p, op ? &result_p : nullptr);
+
+          if (result_p)
+            {
+            (*item_pp)->as<SkVector3>() = result_p->as<SkVector3>();
+            result_p->dereference();
+            }
+          }
+        }
+
+      secs[op][0] = FPlatformTime::Seconds() - start_secs;
+
+      // Bulk
+      start_secs = FPlatformTime::Seconds();
+
+      for (uint32_t repeat = 0u; repeat < Repeat_count; repeat++)
+        {
+        SkInstance * bulk_args[2] = { list_p, arg_p };
+
+        list_p->reference();
+        arg_p->reference();
+        vec3_class.method_call(op_names[op][1], bulk_args, 2u);
+        }
+
+      secs[op][1] = FPlatformTime::Seconds() - start_secs;
+      }
+
+    ADebug::print_format(
+      "\nVector3 bulk ops - %u vectors x %u\n"
+      "  add_assign per item:   %8.3f ms\n  add_assign_all:        %8.3f ms (%.2fx)\n"
+      "  transform_by per item: %8.3f ms\n  transform_by_all:      %8.3f ms (%.2fx)\n",
+      vec_count, uint32_t(Repeat_count),
+      secs[0][0] * 1000.0, secs[0][1] * 1000.0, secs[0][0] / FMath::Max(secs[0][1], 1e-9),
+      secs[1][0] * 1000.0, secs[1][1] * 1000.0, secs[1][0] / FMath::Max(secs[1][1], 1e-9));
+
+    xform_p->dereference();
+    vec_p->dereference();
+    list_p->dereference();
+    }
+
+  FAutoConsoleCommand g_cmd_bench_vector3(TEXT("sk.Bench.Vector3"), TEXT("Times Vector3 add_assign/transform_by called per list item against add_assign_all/transform_by_all. Argument: number of vectors (default 10000)."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_bench_vector3));
+
+  //---------------------------------------------------------------------------------------
+  // Array reads - times converting a TArray of 10, 1000 and 100000 integers and of as many
+  // Vector3 structs to a List the way a script reads a TArray data member: through
+  // new_list_from_raw_array() which boxes items straight into the list storage.  As a
+  // reference the same items are boxed and appended to the list one at a time.  Each
+  // conversion is repeated so that the same total number of items are boxed.
+  //
+  // Argument: total number of items boxed per timing (default 1000000)
+  void cmd_bench_array(const TArray<FString> & args)
+    {
+    if (!is_script_bench_ready())
+      {
+      return;
+      }
+
+    uint32_t item_total = uint32_t(FMath::Max(args.Num() ? FCString::Atoi(*args[0]) : 1000000, 1));
+
+    const uint32_t lengths[] = { 10u, 1000u, 100000u };
+
+    // Raw data info of the items - at offset 0 of each item
+    const tSkRawDataInfo int_raw_data_info = (tSkRawDataInfo(sizeof(int32))
+      | (tSkRawDataInfo(1u) << SkUEClassBindingHelper::Raw_data_type_extra_shift))  // Signed
+      << SkUEClassBindingHelper::Raw_data_info_type_shift;
+    const tSkRawDataInfo vec_raw_data_info = tSkRawDataInfo(sizeof(FVector)) << SkUEClassBindingHelper::Raw_data_info_type_shift;
+
+    TArray<int32>   ints;
+    TArray<FVector> vecs;
+    FRandomStream   random(1);
+
+    ints.SetNumUninitialized(lengths[2]);
+    vecs.SetNumUninitialized(lengths[2]);
+    for (int32 idx = 0; idx < ints.Num(); idx++)
+      {
+      ints[idx] = random.RandHelper(MAX_int32);
+      vecs[idx] = random.VRand();
+      }
+
+    ADebug::print_format("\nArray reads - %u items boxed per timing\n                       boxed into list   appended\n", item_total);
+
+    for (uint32_t pass = 0u; pass < 2u; pass++)
+      {
+      bool             is_vec        = (pass == 1u);
+      const void *     items_p       = is_vec ? static_cast<const void *>(vecs.GetData()) : static_cast<const void *>(ints.GetData());
+      uint32_t         item_size     = is_vec ? sizeof(FVector) : sizeof(int32);
+      tSkRawDataInfo   raw_data_info = is_vec ? vec_raw_data_info : int_raw_data_info;
+      SkClass *        item_class_p  = is_vec ? SkVector3::get_class() : SkInteger::get_class();
+
+      for (uint32_t length : lengths)
+        {
+        uint32_t repeat_count = FMath::Max(item_total / length, 1u);
+        double   secs[2];
+
+        double start_secs = FPlatformTime::Seconds();
+
+        for (uint32_t repeat = 0u; repeat < repeat_count; repeat++)
+          {
+          SkUEClassBindingHelper::new_list_from_raw_array(items_p, length, item_size, raw_data_info, item_class_p)->dereference();
+          }
+
+        secs[0] = FPlatformTime::Seconds() - start_secs;
+
+        start_secs = FPlatformTime::Seconds();
+
+        for (uint32_t repeat = 0u; repeat < repeat_count; repeat++)
+          {
+          SkInstance *          list_p         = SkList::new_instance(length);
+          APArray<SkInstance> & list_instances = list_p->as<SkList>().get_instances();
+          const uint8_t *       item_p         = static_cast<const uint8_t *>(items_p);
+
+          for (uint32_t idx = 0u; idx < length; idx++, item_p += item_size)
+            {
+            list_instances.append(*item_class_p->new_instance_from_raw_data(const_cast<uint8_t *>(item_p), raw_data_info, item_class_p));
+            }
+
+          list_p->dereference();
+          }
+
+        secs[1] = FPlatformTime::Seconds() - start_secs;
+
+        ADebug::print_format(
+          "  %-7s x %6u:  %8.3f ms       %8.3f ms (%.2fx)\n",
+          is_vec ? "Vector3" : "Integer", length, secs[0] * 1000.0, secs[1] * 1000.0, secs[1] / FMath::Max(secs[0], 1e-9));
+        }
+      }
+    }
+
+  FAutoConsoleCommand g_cmd_bench_array(TEXT("sk.Bench.Array"), TEXT("Times converting TArrays of 10, 1000 and 100000 integers and Vector3 structs to Lists. Argument: total number of items boxed per timing (default 1000000)."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_bench_array));
+
+  //---------------------------------------------------------------------------------------
+  // Blueprint calls into scripts - calls a script method exposed to Blueprints on an actor
+  // in a game world through ProcessEvent() - the same path a Blueprint node takes into
+  // SkUEReflectionManager::exec_sk_method() - as often as a busy frame might.  Parameters
+  // are left at their zero values.  The script method runs for real so pick one without
+  // side effects that matter.  Without a method name the candidates are listed.
+  //
+  // Arguments: name of the method as seen by Blueprints, number of calls (default 10000)
+  void cmd_bench_bp_calls(const TArray<FString> & args)
+    {
+    enum { Candidates_max = 32 };
+
+    if (!is_script_bench_ready())
+      {
+      return;
+      }
+
+    FString     function_name   = args.Num() ? args[0] : FString();
+    uint32_t    call_count      = uint32_t(FMath::Max(args.Num() > 1 ? FCString::Atoi(*args[1]) : 10000, 1));
+    AActor *    actor_p         = nullptr;
+    UFunction * function_p      = nullptr;
+    uint32_t    candidate_count = 0u;
+
+    if (function_name.IsEmpty())
+      {
+      ADebug::print("\nScript methods callable from Blueprints on actors in game worlds:\n");
+      }
+
+    for (TObjectIterator<AActor> actor_it; actor_it && !function_p; ++actor_it)
+      {
+      AActor * candidate_actor_p = *actor_it;
+
+      if (candidate_actor_p->HasAnyFlags(RF_ClassDefaultObject) || candidate_actor_p->IsPendingKill()
+        || !candidate_actor_p->GetWorld() || !candidate_actor_p->GetWorld()->IsGameWorld())
+        {
+        continue;
+        }
+
+      for (TFieldIterator<UFunction> function_it(candidate_actor_p->GetClass()); function_it; ++function_it)
+        {
+        if (SkUEReflectionManager::is_skookum_reflected_method_call(*function_it))
+          {
+          if (function_name.IsEmpty())
+            {
+            if (candidate_count++ < Candidates_max)
+              {
+              ADebug::print_format("  %S on %S\n", *function_it->GetName(), *candidate_actor_p->GetName());
+              }
+            }
+          else if (function_it->GetName() == function_name)
+            {
+            actor_p    = candidate_actor_p;
+            function_p = *function_it;
+            break;
+            }
+          }
+        }
+      }
+
+    if (!function_p)
+      {
+      if (!function_name.IsEmpty())
+        {
+        ADebug::print_format("\nNo actor in a game world has a script method '%S' callable from Blueprints.\n", *function_name);
+        }
+      else if (candidate_count > Candidates_max)
+        {
+        ADebug::print_format("  ... and %u more\n", candidate_count - Candidates_max);
+        }
+      return;
+      }
+
+    // Parameters including the return value - zeroed and constructed once for all calls
+    uint8 * params_p = (uint8 *)FMemory::Malloc(FMath::Max<int32>(function_p->ParmsSize, 1), function_p->GetMinAlignment());
+
+    FMemory::Memzero(params_p, function_p->ParmsSize);
+    for (TFieldIterator<UProperty> param_it(function_p); param_it && (param_it->PropertyFlags & CPF_Parm); ++param_it)
+      {
+      param_it->InitializeValue_InContainer(params_p);
+      }
+
+    double start_secs = FPlatformTime::Seconds();
+
+    for (uint32_t idx = 0u; idx < call_count; idx++)
+      {
+      actor_p->ProcessEvent(function_p, params_p);
+      }
+
+    double secs = FPlatformTime::Seconds() - start_secs;
+
+    for (TFieldIterator<UProperty> param_it(function_p); param_it && (param_it->PropertyFlags & CPF_Parm); ++param_it)
+      {
+      param_it->DestroyValue_InContainer(params_p);
+      }
+    FMemory::Free(params_p);
+
+    ADebug::print_format(
+      "\nBlueprint to script calls - %S on %S (%s) x %u\n  total: %8.3f ms (%.1f%% of a 60Hz frame)\n  call:  %8.1f ns\n",
+      *function_name, *actor_p->GetName(), (function_p->ReturnValueOffset != MAX_uint16) ? "result passed back" : "no result", call_count,
+      secs * 1000.0, secs * 6000.0, secs * 1e9 / double(call_count));
+    }
+
+  FAutoConsoleCommand g_cmd_bench_bp_calls(TEXT("sk.Bench.BlueprintCalls"), TEXT("Times calling a script method exposed to Blueprints on an actor many times. Arguments: method name (lists candidates if omitted), number of calls (default 10000)."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_bench_bp_calls));
+
+  } // End unnamed namespace
+
+#endif  // !UE_BUILD_SHIPPING
@@ -57,6 +57,8 @@ TMap<SkClassDescBase*, TWeakObjectPtr<UBlueprint>>  SkUEClassBindingHelper::ms_d
 TMap<UBlueprint*, SkClass*>                         SkUEClassBindingHelper::ms_dynamic_class_map_u2s;
 #endif
 
+TMap<UClass*, SkUEClassBindingHelper::ObjectClassInfo> SkUEClassBindingHelper::ms_object_class_infos;
+
 int32_t                                             SkUEClassBindingHelper::ms_world_data_idx = -1;
 
 const FName                                         SkUEClassBindingHelper::NAME_Entity("Entity");
@@ -111,11 +113,7 @@ SkClass * SkUEClassBindingHelper::get_object_class(UObject * obj_p, UClass * def
     UClass * ue_class_p = obj_p->GetClass();
     if (ue_class_p != def_ue_class_p)
       {
-      // Crawl up class hierarchy until we find a class known to Sk
-      do 
-        {
-        sk_class_p = get_sk_class_from_ue_class(ue_class_p);
-        } while (!sk_class_p && (ue_class_p = ue_class_p->GetSuperClass()) != nullptr);
+      sk_class_p = get_object_class_info(ue_class_p).m_sk_class_p;
       SK_ASSERTX(sk_class_p, a_str_format("UObject of type '%S' has no matching SkookumScript type!", *obj_p->GetClass()->GetName()));
       }
     }
@@ -124,95 +122,139 @@ SkClass * SkUEClassBindingHelper::get_object_class(UObject * obj_p, UClass * def
   }
 
 //---------------------------------------------------------------------------------------
-// Get the embedded, dedicated SkInstance from an object
-// Note: The instance is _not_ referenced
-SkInstance * SkUEClassBindingHelper::get_embedded_instance(UObject * obj_p, SkClass * sk_class_p)
+// Resolve class info of a UClass and store it in the cache
+const SkUEClassBindingHelper::ObjectClassInfo & SkUEClassBindingHelper::resolve_object_class_info(UClass * ue_class_p)
   {
-  if (obj_p)
+  // Crawl up class hierarchy until we find a class known to Sk
+  SkClass * sk_class_p;
+  UClass * ue_super_class_p = ue_class_p;
+  do
+    {
+    sk_class_p = get_sk_class_from_ue_class(ue_super_class_p);
+    } while (!sk_class_p && (ue_super_class_p = ue_super_class_p->GetSuperClass()) != nullptr);
+
+  ObjectClassInfo & info = ms_object_class_infos.Add(ue_class_p);
+  info.m_ue_class = ue_class_p;
+  info.m_sk_class_p = sk_class_p;
+  compute_embedded_instance_lookup(&info, ue_class_p, sk_class_p);
+  return info;
+  }
+
+//---------------------------------------------------------------------------------------
+// Remove cached class info of classes that have been garbage collected - their memory
+// might get reused by new classes
+void SkUEClassBindingHelper::purge_object_class_cache()
+  {
+  for (auto info_it = ms_object_class_infos.CreateIterator(); info_it; ++info_it)
+    {
+    if (info_it.Value().m_ue_class.IsStale())
+      {
+      info_it.RemoveCurrent();
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Determine where to look for the embedded SkInstance of objects of a given class
+void SkUEClassBindingHelper::compute_embedded_instance_lookup(ObjectClassInfo * info_p, UClass * ue_class_p, SkClass * sk_class_p)
+  {
+  info_p->m_instance_offset = 0;
+  info_p->m_lookup = 0;
+
+  if (sk_class_p)
     {
     // Check if we have an instance stored inside the UObject itself
     uint32_t instance_offset = sk_class_p->get_user_data_int();
     if (instance_offset)
       {
       #if !UE_BUILD_SHIPPING
-        if (instance_offset >= (uint32_t)obj_p->GetClass()->PropertiesSize)
+        if (instance_offset >= (uint32_t)ue_class_p->PropertiesSize)
           {
-          SK_ERRORX(a_str_format("Instance offset out of range for actor '%S' of class '%S'!", *obj_p->GetName(), *obj_p->GetClass()->GetName()));
-          return nullptr;
+          SK_ERRORX(a_str_format("Instance offset out of range for class '%S'!", *ue_class_p->GetName()));
+          return;
           }
       #endif
 
-      SkInstance * instance_p = USkookumScriptInstanceProperty::get_instance((uint8_t *)obj_p + instance_offset);
-      if (instance_p)
-        {
-        return instance_p;
-        }
+      info_p->m_instance_offset = instance_offset;
+      info_p->m_lookup |= ObjectClassInfo::Lookup_offset;
       }
 
     // Else, look for components that might have an instance stored inside
     if (sk_class_p->is_actor_class())
       {
-      USkookumScriptClassDataComponent * component_p = static_cast<USkookumScriptClassDataComponent *>(static_cast<AActor *>(obj_p)->GetComponentByClass(USkookumScriptClassDataComponent::StaticClass()));
-      if (component_p)
-        {
-        SkInstance * instance_p = component_p->get_sk_actor_instance();
-        if (instance_p)
-          {
-          return instance_p;
-          }
-        }
+      info_p->m_lookup |= ObjectClassInfo::Lookup_actor_component;
       }
     else if (sk_class_p->is_component_class())
       {
-      USkookumScriptBehaviorComponent * component_p = static_cast<USkookumScriptBehaviorComponent *>(static_cast<UObject *>(obj_p));
-      SkInstance * instance_p = component_p->get_sk_component_instance();
-      if (instance_p)
-        {
-        return instance_p;
-        }
+      info_p->m_lookup |= ObjectClassInfo::Lookup_behavior_component;
       }
     }
+  }
+
+//---------------------------------------------------------------------------------------
+// Called by ensure_class_loaded() for classes that are part of a demand loaded group
+void SkUEClassBindingHelper::use_demand_loaded_class(SkClass * sk_class_p)
+  {
+  SkUERuntime::get_singleton()->use_demand_loaded_class(sk_class_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Get the embedded, dedicated SkInstance from an object
+// Note: The instance is _not_ referenced
+SkInstance * SkUEClassBindingHelper::get_embedded_instance(UObject * obj_p, SkClass * sk_class_p)
+  {
+  if (obj_p)
+    {
+    // Usually sk_class_p was obtained via get_object_class() so the cached lookup applies
+    UClass * ue_class_p = obj_p->GetClass();
+    const ObjectClassInfo & info = get_object_class_info(ue_class_p);
+    if (info.m_sk_class_p == sk_class_p)
+      {
+      return get_embedded_instance(obj_p, info);
+      }
+
+    ObjectClassInfo super_info;
+    compute_embedded_instance_lookup(&super_info, ue_class_p, sk_class_p);
+    return get_embedded_instance(obj_p, super_info);
+    }
 
   return nullptr;
   }
 
 //---------------------------------------------------------------------------------------
-// Optimized version of get_embedded_instance() for known actors
+// Version of get_embedded_instance() for known actors
 // Note: The instance is _not_ referenced
 SkInstance * SkUEClassBindingHelper::get_embedded_instance(AActor * actor_p, SkClass * sk_class_p)
   {
-  if (actor_p)
+  return get_embedded_instance(static_cast<UObject *>(actor_p), sk_class_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Get the embedded SkInstance from an object using a precomputed lookup
+// Note: The instance is _not_ referenced
+SkInstance * SkUEClassBindingHelper::get_embedded_instance(UObject * obj_p, const ObjectClassInfo & info)
+  {
+  if (info.m_lookup & ObjectClassInfo::Lookup_offset)
     {
-    // Check if we have an instance stored inside the UObject itself
-    uint32_t instance_offset = sk_class_p->get_user_data_int();
-    if (instance_offset)
+    SkInstance * instance_p = USkookumScriptInstanceProperty::get_instance((uint8_t *)obj_p + info.m_instance_offset);
+    if (instance_p)
       {
-      #if !UE_BUILD_SHIPPING
-        if (instance_offset >= (uint32_t)actor_p->GetClass()->PropertiesSize)
-          {
-          SK_ERRORX(a_str_format("Instance offset out of range for actor '%S' of class '%S'!", *actor_p->GetName(), *actor_p->GetClass()->GetName()));
-          return nullptr;
-          }
-      #endif
-
-      SkInstance * instance_p = USkookumScriptInstanceProperty::get_instance((uint8_t *)actor_p + instance_offset);
-      if (instance_p)
-        {
-        return instance_p;
-        }
+      return instance_p;
       }
+    }
 
-    // Else, look for component
-    USkookumScriptClassDataComponent * component_p = static_cast<USkookumScriptClassDataComponent *>(actor_p->GetComponentByClass(USkookumScriptClassDataComponent::StaticClass()));
+  if (info.m_lookup & ObjectClassInfo::Lookup_actor_component)
+    {
+    USkookumScriptClassDataComponent * component_p = static_cast<USkookumScriptClassDataComponent *>(static_cast<AActor *>(obj_p)->GetComponentByClass(USkookumScriptClassDataComponent::StaticClass()));
     if (component_p)
       {
-      SkInstance * instance_p = component_p->get_sk_actor_instance();
-      if (instance_p)
-        {
-        return instance_p;
-        }
+      return component_p->get_sk_actor_instance();
       }
     }
+  else if (info.m_lookup & ObjectClassInfo::Lookup_behavior_component)
+    {
+    return static_cast<USkookumScriptBehaviorComponent *>(obj_p)->get_sk_component_instance();
+    }
 
   return nullptr;
   }
@@ -751,15 +793,29 @@ SkInstance * SkUEClassBindingHelper::access_raw_data_list(void * obj_p, tSkRawDa
     }
 
   // Get value
-  SkInstance * instance_p = SkList::new_instance(data_p->Num());
+  return new_list_from_raw_array(data_p->GetData(), data_p->Num(), item_size, item_raw_data_info, item_type_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Create a new List holding a boxed copy of each of num_elements items stored item_size
+// bytes apart starting at items_p
+SkInstance * SkUEClassBindingHelper::new_list_from_raw_array(const void * items_p, uint32_t num_elements, uint32_t item_size, tSkRawDataInfo item_raw_data_info, SkClassDescBase * item_type_p)
+  {
+  SkClass * item_class_p = item_type_p->get_key_class();
+  SkInstance * instance_p = SkList::new_instance(num_elements);
   SkInstanceList & list = instance_p->as<SkList>();
   APArray<SkInstance> & list_instances = list.get_instances();
-  uint8_t * item_array_p = (uint8_t *)data_p->GetData();
-  for (uint32_t i = data_p->Num(); i; --i)
+
+  // Box elements straight into the list's storage rather than appending one at a time
+  list_instances.ensure_size(num_elements);
+  SkInstance ** list_item_pp = list_instances.get_array();
+  uint8_t * item_array_p = (uint8_t *)items_p;
+  for (uint32_t i = 0; i < num_elements; ++i)
     {
-    list_instances.append(*item_class_p->new_instance_from_raw_data(item_array_p, item_raw_data_info, item_type_p));
+    list_item_pp[i] = item_class_p->new_instance_from_raw_data(item_array_p, item_raw_data_info, item_type_p);
     item_array_p += item_size;
     }
+  list_instances.set_length_unsafe(num_elements);
   return instance_p;
   }
 
@@ -822,6 +878,7 @@ void SkUEClassBindingHelper::reset_static_class_mappings(uint32_t reserve)
   ms_static_class_map_s2u.Reset();
   ms_static_class_map_u2s.Reserve(reserve);
   ms_static_class_map_s2u.Reserve(reserve);
+  invalidate_object_class_cache();
   }
 
 //---------------------------------------------------------------------------------------
@@ -886,6 +943,7 @@ void SkUEClassBindingHelper::forget_sk_classes_in_all_mappings()
   ms_static_class_map_s2u.Reset();
   ms_static_struct_map_s2u.Reset();
   //ms_static_enum_map_s2u.Reset();
+  invalidate_object_class_cache();
 
   // Also clear out dynamic mappings if we got any
   #if WITH_EDITORONLY_DATA
@@ -921,6 +979,7 @@ void SkUEClassBindingHelper::add_static_class_mapping(SkClass * sk_class_p, UCla
   SK_ASSERTX(sk_class_p && ue_class_p, a_str_format("Tried to add static class mapping between `%s` and `%S` one of which is null.", sk_class_p ? sk_class_p->get_name_cstr() : "(null)", ue_class_p ? *ue_class_p->GetName() : TEXT("(null)")));
   ms_static_class_map_u2s.Add(ue_class_p, sk_class_p);
   ms_static_class_map_s2u.Add(sk_class_p, ue_class_p);
+  invalidate_object_class_cache();
   }
 
 //---------------------------------------------------------------------------------------
@@ -1199,6 +1258,7 @@ void SkUEClassBindingHelper::reset_dynamic_class_mappings()
   {
   ms_dynamic_class_map_u2s.Reset();
   ms_dynamic_class_map_s2u.Reset();
+  invalidate_object_class_cache();
   }
 
 //---------------------------------------------------------------------------------------
@@ -1219,6 +1279,7 @@ UClass * SkUEClassBindingHelper::add_dynamic_class_mapping(SkClassDescBase * sk_
   // Add to map of known class equivalences
   ms_dynamic_class_map_u2s.Add(blueprint_p, sk_class_p);
   ms_dynamic_class_map_s2u.Add(sk_class_p, blueprint_p);
+  invalidate_object_class_cache();
 
   // Return latest generated class belonging to this blueprint
   return blueprint_p->GeneratedClass;
@@ -1237,6 +1298,7 @@ SkClass * SkUEClassBindingHelper::add_dynamic_class_mapping(UBlueprint * bluepri
     {
     ms_dynamic_class_map_u2s.Add(blueprint_p, sk_class_p);
     ms_dynamic_class_map_s2u.Add(sk_class_p, blueprint_p);
+    invalidate_object_class_cache();
     }
 
   return sk_class_p;
@@ -0,0 +1,430 @@
+//=======================================================================================
+// Copyright (c) 2001-2017 Agog Labs Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=======================================================================================
+
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+//
+// Script profiler driven by scopes placed where the plugin runs scripts
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "SkUEProfiler.hpp"
+
+#if defined(SKUE_PROFILER)
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+#include <SkookumScript/SkClass.hpp>
+#include <SkookumScript/SkInvokableBase.hpp>
+#include <SkookumScript/SkInvokedBase.hpp>
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+  {
+
+  //---------------------------------------------------------------------------------------
+
+  void cmd_profile_instrument(const TArray<FString> & args)
+    {
+    SkUEProfiler::start(SkUEProfiler::Mode_instrument);
+    }
+
+  //---------------------------------------------------------------------------------------
+
+  void cmd_profile_sample(const TArray<FString> & args)
+    {
+    int32 samples_per_second = args.Num() ? FCString::Atoi(*args[0]) : 1000;
+    SkUEProfiler::start(SkUEProfiler::Mode_sample, (uint32_t)FMath::Max(samples_per_second, 1));
+    }
+
+  //---------------------------------------------------------------------------------------
+
+  void cmd_profile_stop(const TArray<FString> & args)
+    {
+    SkUEProfiler::stop();
+    }
+
+  //---------------------------------------------------------------------------------------
+
+  void cmd_profile_export(const TArray<FString> & args)
+    {
+    FString file_path = args.Num()
+      ? args[0]
+      : FPaths::ProfilingDir() / TEXT("SkookumScript-") + FDateTime::Now().ToString();
+
+    SkUEProfiler::export_flat(file_path + TEXT(".txt"));
+    SkUEProfiler::export_chrome_trace(file_path + TEXT(".json"));
+    }
+
+  FAutoConsoleCommand g_cmd_profile_instrument(TEXT("sk.Profile.Instrument"), TEXT("Starts timing every SkookumScript routine call."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_profile_instrument));
+  FAutoConsoleCommand g_cmd_profile_sample(TEXT("sk.Profile.Sample"), TEXT("Starts sampling SkookumScript call stacks. Argument: samples per second (default 1000)."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_profile_sample));
+  FAutoConsoleCommand g_cmd_profile_stop(TEXT("sk.Profile.Stop"), TEXT("Stops SkookumScript profiling - gathered data is kept until the next start."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_profile_stop));
+  FAutoConsoleCommand g_cmd_profile_export(TEXT("sk.Profile.Export"), TEXT("Writes SkookumScript profile as .txt and .json (Chrome trace). Argument: file path without extension (default in Saved/Profiling)."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_profile_export));
+
+  } // End unnamed namespace
+
+
+//=======================================================================================
+// Class Data
+//=======================================================================================
+
+SkUEProfiler::eMode                     SkUEProfiler::ms_mode = SkUEProfiler::Mode_off;
+TMap<FString, uint32_t>                 SkUEProfiler::ms_entry_map;
+TMap<SkInvokableBase *, uint32_t>       SkUEProfiler::ms_invokable_map;
+TArray<SkUEProfiler::Entry>             SkUEProfiler::ms_entries;
+SkUEProfiler::Frame                     SkUEProfiler::ms_stack[SkUEProfiler::Stack_depth_max];
+uint32_t                                SkUEProfiler::ms_stack_depth = 0u;
+SkUEProfiler::Event *                   SkUEProfiler::ms_events_p = nullptr;
+uint32_t                                SkUEProfiler::ms_event_count = 0u;
+SkUEProfiler::Sample *                  SkUEProfiler::ms_samples_p = nullptr;
+uint32_t                                SkUEProfiler::ms_sample_count = 0u;
+uint64_t                                SkUEProfiler::ms_sample_interval_cycles = 0u;
+uint64_t                                SkUEProfiler::ms_sample_next_cycles = 0u;
+uint64_t                                SkUEProfiler::ms_start_cycles = 0u;
+
+
+//=======================================================================================
+// Class Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Discards previously gathered data and starts profiling in the given mode
+void SkUEProfiler::start(eMode mode, uint32_t samples_per_second)
+  {
+  stop();
+  reset();
+
+  if (mode == Mode_instrument && !ms_events_p)
+    {
+    ms_events_p = static_cast<Event *>(FMemory::Malloc(Event_capacity * sizeof(Event)));
+    }
+  if (mode == Mode_sample && !ms_samples_p)
+    {
+    ms_samples_p = static_cast<Sample *>(FMemory::Malloc(Sample_capacity * sizeof(Sample)));
+    }
+
+  ms_start_cycles = FPlatformTime::Cycles64();
+  ms_sample_interval_cycles = uint64_t(1.0 / (FPlatformTime::GetSecondsPerCycle64() * double(samples_per_second)));
+  ms_sample_next_cycles = ms_start_cycles + ms_sample_interval_cycles;
+  ms_mode = mode;
+  }
+
+//---------------------------------------------------------------------------------------
+// Stops profiling - gathered data is kept so it can be exported
+void SkUEProfiler::stop()
+  {
+  if (ms_mode == Mode_off)
+    {
+    return;
+    }
+
+  // Close scopes still in progress
+  while (ms_stack_depth)
+    {
+    exit();
+    }
+
+  ms_mode = Mode_off;
+  }
+
+//---------------------------------------------------------------------------------------
+// Discards all gathered data
+void SkUEProfiler::reset()
+  {
+  ms_entry_map.Empty();
+  ms_invokable_map.Empty();
+  ms_entries.Empty();
+  ms_stack_depth  = 0u;
+  ms_event_count  = 0u;
+  ms_sample_count = 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Stops profiling and frees all memory - called on shutdown
+void SkUEProfiler::deinitialize()
+  {
+  stop();
+  reset();
+
+  if (ms_events_p)
+    {
+    FMemory::Free(ms_events_p);
+    ms_events_p = nullptr;
+    }
+  if (ms_samples_p)
+    {
+    FMemory::Free(ms_samples_p);
+    ms_samples_p = nullptr;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Writes the most recent calls as Chrome trace events ("X" complete events)
+bool SkUEProfiler::export_chrome_trace(const FString & file_path)
+  {
+  double us_per_cycle = FPlatformTime::GetSecondsPerCycle64() * 1000000.0;
+  uint32_t event_count = FMath::Min<uint32_t>(ms_event_count, Event_capacity);
+  AString  trace;
+
+  trace.ensure_size(64u + event_count * 96u);
+
+  trace.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  for (uint32_t i = ms_event_count - event_count; i != ms_event_count; ++i)
+    {
+    const Event & event = ms_events_p[i & (Event_capacity - 1u)];
+    trace.append(a_str_format(
+      "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}\n",
+      (i + event_count != ms_event_count) ? "," : "",
+      ms_entries[event.m_entry_idx].m_name.as_cstr(),
+      double(event.m_start_cycles - ms_start_cycles) * us_per_cycle,
+      double(event.m_cycles) * us_per_cycle));
+    }
+  trace.append("]}\n");
+
+  return FFileHelper::SaveStringToFile(FString(trace.as_cstr()), *file_path);
+  }
+
+//---------------------------------------------------------------------------------------
+// Writes cost per invokable sorted by exclusive time followed by the sampled call stacks
+// (one line per unique stack, outermost routine first, with the number of samples)
+bool SkUEProfiler::export_flat(const FString & file_path)
+  {
+  double ms_per_cycle = FPlatformTime::GetSecondsPerCycle64() * 1000.0;
+  AString profile;
+
+  profile.ensure_size(4096u);
+
+  // Routines
+  TArray<uint32_t> order;
+  order.Reserve(ms_entries.Num());
+  for (int32 i = 0; i < ms_entries.Num(); ++i)
+    {
+    if (ms_entries[i].m_calls)
+      {
+      order.Add(uint32_t(i));
+      }
+    }
+  order.Sort([](uint32_t lhs, uint32_t rhs) { return ms_entries[lhs].m_exclusive_cycles > ms_entries[rhs].m_exclusive_cycles; });
+
+  profile.append("# exclusive_ms inclusive_ms calls routine\n");
+  for (uint32_t entry_idx : order)
+    {
+    const Entry & entry = ms_entries[entry_idx];
+    profile.append(a_str_format("%12.3f %12.3f %10llu %s\n", double(entry.m_exclusive_cycles) * ms_per_cycle, double(entry.m_inclusive_cycles) * ms_per_cycle, (unsigned long long)entry.m_calls, entry.m_name.as_cstr()));
+    }
+
+  // Samples
+  TMap<FString, uint32_t> stack_counts;
+  uint32_t sample_count = FMath::Min<uint32_t>(ms_sample_count, Sample_capacity);
+  for (uint32_t i = ms_sample_count - sample_count; i != ms_sample_count; ++i)
+    {
+    const Sample & sample = ms_samples_p[i & (Sample_capacity - 1u)];
+    AString stack;
+    for (uint32_t depth = sample.m_depth; depth--;)
+      {
+      stack.append(ms_entries[sample.m_entry_idx[depth]].m_name);
+      if (depth)
+        {
+        stack.append(';');
+        }
+      }
+    ++stack_counts.FindOrAdd(FString(stack.as_cstr()));
+    }
+  stack_counts.ValueSort([](uint32_t lhs, uint32_t rhs) { return lhs > rhs; });
+
+  profile.append(a_str_format("\n# samples call_stack (%u samples)\n", sample_count));
+  for (auto & stack_pair : stack_counts)
+    {
+    profile.append(a_str_format("%10u %s\n", stack_pair.Value, TCHAR_TO_ANSI(*stack_pair.Key)));
+    }
+
+  return FFileHelper::SaveStringToFile(FString(profile.as_cstr()), *file_path);
+  }
+
+//---------------------------------------------------------------------------------------
+// Starts profiling a scope - nested inside the scopes already entered
+void SkUEProfiler::enter(uint32_t entry_idx)
+  {
+  uint64_t now_cycles = FPlatformTime::Cycles64();
+
+  if (ms_stack_depth < Stack_depth_max)
+    {
+    Frame & frame = ms_stack[ms_stack_depth];
+    frame.m_entry_idx    = entry_idx;
+    frame.m_start_cycles = now_cycles;
+    frame.m_child_cycles = 0u;
+    }
+  ms_stack_depth++;
+
+  if ((ms_mode == Mode_sample) && (now_cycles >= ms_sample_next_cycles))
+    {
+    sample_stack(nullptr);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Stops profiling the innermost scope and adds its cost
+void SkUEProfiler::exit()
+  {
+  // Profiling may have been restarted while in the scope
+  if (!ms_stack_depth)
+    {
+    return;
+    }
+
+  if (--ms_stack_depth >= Stack_depth_max)
+    {
+    return;
+    }
+
+  if (ms_mode != Mode_instrument)
+    {
+    return;
+    }
+
+  const Frame & frame = ms_stack[ms_stack_depth];
+  uint64_t cycles = FPlatformTime::Cycles64() - frame.m_start_cycles;
+
+  if (ms_stack_depth)
+    {
+    ms_stack[ms_stack_depth - 1u].m_child_cycles += cycles;
+    }
+
+  Entry & entry = ms_entries[frame.m_entry_idx];
+  entry.m_calls++;
+  entry.m_exclusive_cycles += cycles - frame.m_child_cycles;
+
+  // Recursive calls are already included in the outermost call
+  bool is_recursive = false;
+  for (uint32_t idx = 0u; idx < ms_stack_depth; ++idx)
+    {
+    if (ms_stack[idx].m_entry_idx == frame.m_entry_idx)
+      {
+      is_recursive = true;
+      break;
+      }
+    }
+  if (!is_recursive)
+    {
+    entry.m_inclusive_cycles += cycles;
+    }
+
+  Event & event = ms_events_p[ms_event_count++ & (Event_capacity - 1u)];
+  event.m_entry_idx    = frame.m_entry_idx;
+  event.m_depth        = ms_stack_depth;
+  event.m_start_cycles = frame.m_start_cycles;
+  event.m_cycles       = cycles;
+  }
+
+//---------------------------------------------------------------------------------------
+// Takes a sample if it is time to - the script call stack of `icontext_p` (if any)
+// followed by the scopes currently entered
+void SkUEProfiler::sample_stack(SkInvokedContextBase * icontext_p)
+  {
+  uint64_t now_cycles = FPlatformTime::Cycles64();
+
+  if (now_cycles < ms_sample_next_cycles)
+    {
+    return;
+    }
+
+  ms_sample_next_cycles = now_cycles + ms_sample_interval_cycles;
+
+  Sample & sample = ms_samples_p[ms_sample_count++ & (Sample_capacity - 1u)];
+  uint32_t depth = 0u;
+
+  for (SkInvokedContextBase * context_p = icontext_p; context_p && depth < Sample_depth_max; context_p = context_p->get_caller_context())
+    {
+    sample.m_entry_idx[depth++] = get_entry_idx(context_p->get_invokable());
+    }
+
+  for (uint32_t frame_idx = FMath::Min<uint32_t>(ms_stack_depth, Stack_depth_max); frame_idx && depth < Sample_depth_max;)
+    {
+    sample.m_entry_idx[depth++] = ms_stack[--frame_idx].m_entry_idx;
+    }
+
+  sample.m_depth = depth;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns index of the entry of a routine - creating it when the routine is seen for the
+// first time
+uint32_t SkUEProfiler::get_entry_idx(SkInvokableBase * invokable_p)
+  {
+  if (!invokable_p)
+    {
+    return get_entry_idx("?");
+    }
+
+  uint32_t name_id  = invokable_p->get_name_id();
+  uint32_t scope_id = invokable_p->get_scope()->get_name_id();
+
+  // An invokable seen before - unless this is a different routine at the same address
+  uint32_t * entry_idx_p = ms_invokable_map.Find(invokable_p);
+  if (entry_idx_p
+    && (ms_entries[*entry_idx_p].m_name_id == name_id)
+    && (ms_entries[*entry_idx_p].m_scope_id == scope_id))
+    {
+    return *entry_idx_p;
+    }
+
+  AString  name = invokable_p->as_string_name(true);
+  uint32_t * named_idx_p = ms_entry_map.Find(FString(name.as_cstr()));
+  uint32_t entry_idx = named_idx_p ? *named_idx_p : add_entry(name, name_id, scope_id);
+
+  ms_invokable_map.Add(invokable_p, entry_idx);
+  return entry_idx;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns index of the entry of a named scope - creating it when first seen
+uint32_t SkUEProfiler::get_entry_idx(const char * name_p)
+  {
+  uint32_t * entry_idx_p = ms_entry_map.Find(FString(name_p));
+
+  return entry_idx_p ? *entry_idx_p : add_entry(AString(name_p), 0u, 0u);
+  }
+
+//---------------------------------------------------------------------------------------
+
+uint32_t SkUEProfiler::add_entry(const AString & name, uint32_t name_id, uint32_t scope_id)
+  {
+  Entry entry;
+  entry.m_name             = name;
+  entry.m_name_id          = name_id;
+  entry.m_scope_id         = scope_id;
+  entry.m_calls            = 0u;
+  entry.m_inclusive_cycles = 0u;
+  entry.m_exclusive_cycles = 0u;
+
+  uint32_t entry_idx = uint32_t(ms_entries.Add(entry));
+  ms_entry_map.Add(FString(name.as_cstr()), entry_idx);
+  return entry_idx;
+  }
+
+#endif  // SKUE_PROFILER
@@ -0,0 +1,208 @@
+//=======================================================================================
+// Copyright (c) 2001-2017 Agog Labs Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=======================================================================================
+
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+//
+// Script profiler driven by scopes placed where the plugin runs scripts
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "CoreGlobals.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+
+#include <AgogCore/AString.hpp>
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+#if !UE_BUILD_SHIPPING && !defined(SKUE_NO_PROFILER)
+  // If this is defined SkUEProfiler is available
+  #define SKUE_PROFILER
+#endif
+
+#if defined(SKUE_PROFILER)
+  // Times the rest of the enclosing block as `_invokable_or_name` while profiling
+  #define SKUE_PROFILE_SCOPE(_invokable_or_name)  SkUEProfiler::Scope _sk_profile_scope(_invokable_or_name)
+  // Notes the script call stack of `_icontext_p` while sampling
+  #define SKUE_PROFILE_SAMPLE(_icontext_p)        SkUEProfiler::sample(_icontext_p)
+#else
+  #define SKUE_PROFILE_SCOPE(_invokable_or_name)  (void(0))
+  #define SKUE_PROFILE_SAMPLE(_icontext_p)        (void(0))
+#endif
+
+
+#if defined(SKUE_PROFILER)
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+class SkInvokableBase;
+class SkInvokedContextBase;
+
+//---------------------------------------------------------------------------------------
+// Notes    Profiles the places where the plugin runs scripts - the per frame script
+//          update, Blueprint calls into script routines and script calls into Blueprint
+//          events.  The precompiled SkookumScript library does not report the routines
+//          it invokes internally, so time spent in the script update is only broken down
+//          further where scripts call back into the engine.  Two modes are available:
+//
+//          Instrument - records inclusive and exclusive time plus call count per scope
+//            and keeps the most recent scopes in a fixed size ring buffer so they can be
+//            exported as a Chrome trace (chrome://tracing).  Coroutines called from
+//            Blueprints are only timed until they first yield.
+//
+//          Sample - at a fixed rate, snapshots the current scopes together with the
+//            script call stack of script code calling into Blueprints.  Samples are only
+//            taken when a scope is entered which keeps the cost at a time check.
+//
+//          Both can be exported to a flat text file sorted by cost - easy to diff
+//          between builds.
+//
+//          Entries are identified by the qualified name of their routine.  Invokables
+//          are only used to find entries quickly and are checked against the name of
+//          the routine first, since scripts may be reloaded while profiling and new
+//          invokables can then reuse the memory of old ones.
+//
+//          Only scopes entered on the game thread are profiled.  Controlled with the
+//          console commands sk.Profile.Instrument, sk.Profile.Sample [samples per
+//          second], sk.Profile.Stop and sk.Profile.Export [file path without extension].
+class SkUEProfiler
+  {
+  public:
+
+  // Nested Structures
+
+    enum eMode
+      {
+      Mode_off,
+      Mode_instrument,
+      Mode_sample
+      };
+
+    // Profiles the lifetime of this object while the profiler is on - use via
+    // SKUE_PROFILE_SCOPE()
+    class Scope
+      {
+      public:
+        Scope(SkInvokableBase * invokable_p) : m_entered(ms_mode != Mode_off && IsInGameThread())  { if (m_entered) { enter(get_entry_idx(invokable_p)); } }
+        Scope(const char * name_p)           : m_entered(ms_mode != Mode_off && IsInGameThread())  { if (m_entered) { enter(get_entry_idx(name_p)); } }
+        ~Scope()                                                                                    { if (m_entered) { exit(); } }
+
+      protected:
+        bool m_entered;
+      };
+
+  // Class Methods
+
+    static void   start(eMode mode, uint32_t samples_per_second = 1000u);
+    static void   stop();
+    static void   reset();
+    static void   deinitialize();
+    static eMode  get_mode()   { return ms_mode; }
+
+    static void   sample(SkInvokedContextBase * icontext_p)  { if (ms_mode == Mode_sample && IsInGameThread()) { sample_stack(icontext_p); } }
+
+    static bool   export_chrome_trace(const FString & file_path);
+    static bool   export_flat(const FString & file_path);
+
+  protected:
+
+  // Internal Structures
+
+    enum
+      {
+      Event_capacity   = 1 << 16,  // Must be a power of two
+      Sample_capacity  = 1 << 14,  // Must be a power of two
+      Sample_depth_max = 32,
+      Stack_depth_max  = 256
+      };
+
+    // Accumulated cost of a routine or named scope
+    struct Entry
+      {
+      AString   m_name;
+      uint32_t  m_name_id;      // Routine name - 0 for named scopes
+      uint32_t  m_scope_id;     // Class of routine - 0 for named scopes
+      uint64_t  m_calls;
+      uint64_t  m_inclusive_cycles;
+      uint64_t  m_exclusive_cycles;
+      };
+
+    // Scope currently being profiled
+    struct Frame
+      {
+      uint32_t  m_entry_idx;
+      uint64_t  m_start_cycles;
+      uint64_t  m_child_cycles;
+      };
+
+    // Completed scope as stored in the ring buffer
+    struct Event
+      {
+      uint32_t  m_entry_idx;
+      uint32_t  m_depth;
+      uint64_t  m_start_cycles;
+      uint64_t  m_cycles;
+      };
+
+    struct Sample
+      {
+      uint32_t  m_depth;
+      uint32_t  m_entry_idx[Sample_depth_max];  // Innermost first
+      };
+
+  // Internal Class Methods
+
+    static void     enter(uint32_t entry_idx);
+    static void     exit();
+    static void     sample_stack(SkInvokedContextBase * icontext_p);
+    static uint32_t get_entry_idx(SkInvokableBase * invokable_p);
+    static uint32_t get_entry_idx(const char * name_p);
+    static uint32_t add_entry(const AString & name, uint32_t name_id, uint32_t scope_id);
+
+  // Class Data Members
+
+    static eMode       ms_mode;
+
+    static TMap<FString, uint32_t>           ms_entry_map;      // Entry index by name
+    static TMap<SkInvokableBase *, uint32_t> ms_invokable_map;  // Quick lookup - see notes above
+    static TArray<Entry>                     ms_entries;
+
+    static Frame       ms_stack[Stack_depth_max];
+    static uint32_t    ms_stack_depth;    // May exceed Stack_depth_max - deeper frames are not recorded
+
+    static Event *     ms_events_p;       // Ring buffer of Event_capacity completed scopes
+    static uint32_t    ms_event_count;    // Total number recorded - the last Event_capacity are kept
+
+    static Sample *    ms_samples_p;      // Ring buffer of Sample_capacity samples
+    static uint32_t    ms_sample_count;   // Total number taken - the last Sample_capacity are kept
+    static uint64_t    ms_sample_interval_cycles;
+    static uint64_t    ms_sample_next_cycles;
+
+    static uint64_t    ms_start_cycles;
+
+  };  // SkUEProfiler
+
+#endif  // SKUE_PROFILER
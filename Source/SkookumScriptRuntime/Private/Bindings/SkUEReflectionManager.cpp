@@ -29,6 +29,7 @@
 #include "Engine/SkUEEntity.hpp"
 #include "Engine/SkUEActor.hpp"
 #include "SkUEUtils.hpp"
+#include "SkUEProfiler.hpp"
 #include "SkookumScriptInstanceProperty.h"
 #include "../../../SkookumScriptGenerator/Private/SkookumScriptGeneratorBase.h"
 
@@ -108,6 +109,10 @@ void SkUEReflectionManager::TypedName::set_byte_size(UProperty * ue_property_p)
 
 SkUEReflectionManager * SkUEReflectionManager::ms_singleton_p;
 
+#if (SKOOKUM & SK_DEBUG)
+  uint32_t SkUEReflectionManager::ms_call_cache_epoch = 1u;
+#endif
+
 SkUEReflectionManager::ReflectedAccessors const SkUEReflectionManager::ms_accessors_boolean         = { &fetch_k2_param_boolean        , &fetch_k2_value_boolean        , &assign_k2_value_boolean        , &store_sk_value_boolean         };
 SkUEReflectionManager::ReflectedAccessors const SkUEReflectionManager::ms_accessors_integer         = { &fetch_k2_param_integer        , &fetch_k2_value_integer        , &assign_k2_value_integer        , &store_sk_value_integer         };
 SkUEReflectionManager::ReflectedAccessors const SkUEReflectionManager::ms_accessors_real            = { &fetch_k2_param_real           , &fetch_k2_value_real           , &assign_k2_value_real           , &store_sk_value_real            };
@@ -142,7 +147,7 @@ SkUEReflectionManager::SkUEReflectionManager()
   ms_struct_rotation_angles_p  = FindObjectChecked<UScriptStruct>(UObject::StaticClass()->GetOutermost(), TEXT("Rotator"), false);
   ms_struct_transform_p        = FindObjectChecked<UScriptStruct>(UObject::StaticClass()->GetOutermost(), TEXT("Transform"), false);
 
-  m_result_name = ASymbol::create("result");
+  m_result_name = ASYMBOL_LITERAL("result");
 
   // Get package to attach reflected classes to
   m_module_package_p = FindObject<UPackage>(nullptr, TEXT("/Script/SkookumScriptRuntime"));
@@ -167,6 +172,11 @@ SkUEReflectionManager::~SkUEReflectionManager()
 
 void SkUEReflectionManager::clear(tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f)
   {
+  #if (SKOOKUM & SK_DEBUG)
+    // Invokables might be going away - forget all resolved call sites
+    invalidate_call_caches();
+  #endif
+
   // Destroy all UFunctions and UProperties we allocated
   for (uint32_t i = 0; i < m_reflected_functions.get_length(); ++i)
     {
@@ -244,6 +254,11 @@ bool SkUEReflectionManager::sync_all_from_sk(tSkUEOnFunctionRemovedFromClassFunc
 // Bind all routines in the binding list to UE4 by generating UFunction objects
 bool SkUEReflectionManager::sync_class_from_sk(SkClass * sk_class_p, tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f)
   {
+  #if (SKOOKUM & SK_DEBUG)
+    // Class was (re)loaded or live updated so its vtables might now point to different invokables
+    invalidate_call_caches();
+  #endif
+
   // Find existing methods of this class and mark them for delete
   ReflectedClass * reflected_class_p = m_reflected_classes.get(sk_class_p->get_name());
   if (reflected_class_p)
@@ -270,6 +285,12 @@ bool SkUEReflectionManager::sync_class_from_sk(SkClass * sk_class_p, tSkUEOnFunc
       m_reflected_classes.append(*reflected_class_p);
       }
     reflected_class_p->m_store_sk_instance = true;
+    reflected_class_p->m_is_dirty = true;
+    }
+  else if (reflected_class_p && reflected_class_p->m_store_sk_instance && !sk_class_p->get_user_data_int())
+    {
+    // Class was reloaded and has lost the offset of its USkookumScriptInstanceProperty
+    reflected_class_p->m_is_dirty = true;
     }
 
   // Gather new functions/events
@@ -708,33 +729,94 @@ bool SkUEReflectionManager::sync_all_to_ue(tSkUEOnFunctionUpdatedFunc * on_funct
   {
   bool anything_changed = false;
 
-  // Loop through all the reflected classes and attach a USkookumScriptInstanceProperty as needed
+  // Only visit classes that changed since the last sync or that could not be fully exposed back then
   for (ReflectedClass * reflected_class_p : m_reflected_classes)
     {
-    if (reflected_class_p->m_store_sk_instance)
+    if (reflected_class_p->m_is_dirty)
       {
-      SkClass * sk_class_p = SkBrain::get_class(reflected_class_p->get_name());
-      if (sk_class_p && !sk_class_p->get_user_data_int())
+      anything_changed |= expose_reflected_class(reflected_class_p, on_function_updated_f, is_final);
+      }
+    }
+
+  return anything_changed;
+  }
+
+//---------------------------------------------------------------------------------------
+// Attach a USkookumScriptInstanceProperty if needed and generate UFunctions for all
+// routines of a reflected class - clears its dirty flag if all of it could be exposed
+bool SkUEReflectionManager::expose_reflected_class(ReflectedClass * reflected_class_p, tSkUEOnFunctionUpdatedFunc * on_function_updated_f, bool is_final)
+  {
+  bool anything_changed = false;
+  bool is_all_exposed = true;
+
+  if (reflected_class_p->m_store_sk_instance)
+    {
+    SkClass * sk_class_p = SkBrain::get_class(reflected_class_p->get_name());
+    if (sk_class_p && !sk_class_p->get_user_data_int())
+      {
+      UClass * ue_class_p = SkUEClassBindingHelper::get_ue_class_from_sk_class(sk_class_p);
+      if (ue_class_p)
         {
-        UClass * ue_class_p = SkUEClassBindingHelper::get_ue_class_from_sk_class(sk_class_p);
-        if (ue_class_p)
-          {
-          reflected_class_p->m_ue_static_class_p = SkUEClassBindingHelper::get_static_ue_class_from_sk_class_super(sk_class_p);
-          anything_changed |= add_instance_property_to_class(ue_class_p, sk_class_p);
-          }
+        reflected_class_p->m_ue_static_class_p = SkUEClassBindingHelper::get_static_ue_class_from_sk_class_super(sk_class_p);
+        anything_changed |= add_instance_property_to_class(ue_class_p, sk_class_p);
+        }
+      else
+        {
+        // UE4 class does not exist yet - try again next time
+        is_all_exposed = false;
         }
       }
     }
 
-  // Loop through all bindings and generate their UFunctions
-  for (uint32_t binding_index = 0; binding_index < m_reflected_functions.get_length(); ++binding_index)
+  for (FunctionIndex function_index : reflected_class_p->m_functions)
     {
-    anything_changed |= expose_reflected_function(binding_index, on_function_updated_f, is_final);
+    anything_changed |= expose_reflected_function(function_index.m_idx, on_function_updated_f, is_final);
+
+    ReflectedFunction * reflected_function_p = m_reflected_functions[function_index.m_idx];
+    if (reflected_function_p
+     && reflected_function_p->m_sk_invokable_p
+     && reflected_function_p->m_sk_invokable_p->get_scope()->is_entity_class() // Only UClasses get UFunctions
+     && !reflected_function_p->m_ue_function_p.IsValid())
+      {
+      is_all_exposed = false;
+      }
     }
 
+  reflected_class_p->m_is_dirty = !is_all_exposed;
+
   return anything_changed;
   }
 
+//---------------------------------------------------------------------------------------
+// Make sure the next sync_all_to_ue() re-exposes the given class (and its subclasses),
+// e.g. after its UE4 counterpart was regenerated and the UFunctions we built went away
+void SkUEReflectionManager::mark_class_dirty(SkClass * sk_class_p, bool recursively)
+  {
+  ReflectedClass * reflected_class_p = m_reflected_classes.get(sk_class_p->get_name());
+  if (reflected_class_p)
+    {
+    reflected_class_p->m_is_dirty = true;
+    }
+
+  if (recursively)
+    {
+    for (SkClass * sk_subclass_p : sk_class_p->get_subclasses())
+      {
+      mark_class_dirty(sk_subclass_p, true);
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Make sure the next sync_all_to_ue() revisits every reflected class
+void SkUEReflectionManager::mark_all_dirty()
+  {
+  for (ReflectedClass * reflected_class_p : m_reflected_classes)
+    {
+    reflected_class_p->m_is_dirty = true;
+    }
+  }
+
 //---------------------------------------------------------------------------------------
 
 bool SkUEReflectionManager::does_class_need_instance_property(SkClass * sk_class_p)
@@ -796,6 +878,7 @@ bool SkUEReflectionManager::add_instance_property_to_class(UClass * ue_class_p,
 
   // Remember offset in the object where the SkInstance pointer is stored
   sk_class_p->set_user_data_int_recursively(property_p->GetOffset_ForInternal());
+  SkUEClassBindingHelper::invalidate_object_class_cache();
 
   return success;
   }
@@ -817,6 +900,16 @@ bool SkUEReflectionManager::is_skookum_reflected_call(UFunction * function_p)
       || native_function_p == (Native)&SkUEReflectionManager::exec_sk_coroutine;
   }
 
+//---------------------------------------------------------------------------------------
+// Same as is_skookum_reflected_call() though excluding coroutines
+
+bool SkUEReflectionManager::is_skookum_reflected_method_call(UFunction * function_p)
+  {
+  Native native_function_p = function_p->GetNativeFunc();
+  return native_function_p == (Native)&SkUEReflectionManager::exec_sk_class_method
+      || native_function_p == (Native)&SkUEReflectionManager::exec_sk_instance_method;
+  }
+
 //---------------------------------------------------------------------------------------
 
 bool SkUEReflectionManager::is_skookum_reflected_event(UFunction * function_p)
@@ -824,27 +917,101 @@ bool SkUEReflectionManager::is_skookum_reflected_event(UFunction * function_p)
   return function_p->RPCId == EventMagicRepOffset;
   }
 
+//---------------------------------------------------------------------------------------
+// Finds the override of a reflected routine to invoke on a receiver of class
+// `class_scope_p`. Release builds only index the receiver's vtable - the by-name
+// fallback and its inline cache exist in SK_DEBUG builds only, for live updates.
+//
+// Returns: invokable to call or nullptr if `class_scope_p` does not have a matching routine
+SkInvokableBase * SkUEReflectionManager::resolve_reflected_call(ReflectedCall & reflected_call, SkClass * class_scope_p, eSkScope scope)
+  {
+  // Make sure routines of demand loaded classes are present
+  SkUEClassBindingHelper::ensure_class_loaded(class_scope_p);
+
+  SkInvokableBase * invokable_p = class_scope_p->get_invokable_from_vtable(scope, reflected_call.m_sk_invokable_p->get_vtable_index());
+
+  #if (SKOOKUM & SK_DEBUG)
+    // If not found, might be due to recent live update and the vtable not being updated yet - try finding it by name
+    if (!invokable_p || invokable_p->get_name() != reflected_call.get_name())
+      {
+      invokable_p = find_reflected_call_by_name(reflected_call, class_scope_p, scope);
+      }
+  #endif
+
+  return invokable_p;
+  }
+
+#if (SKOOKUM & SK_DEBUG)
+
+//---------------------------------------------------------------------------------------
+// Finds the override of a reflected routine by name - used when the vtable is out of date
+// after a live update. The inherited search is slow and a stale vtable stays stale until
+// the next recompile, so each reflected call keeps a small inline cache of the receiver
+// classes it had to look up this way.
+//
+// Returns: invokable to call or nullptr if `class_scope_p` does not have a matching routine
+SkInvokableBase * SkUEReflectionManager::find_reflected_call_by_name(ReflectedCall & reflected_call, SkClass * class_scope_p, eSkScope scope)
+  {
+  CallCacheEntry * cache_p = reflected_call.m_call_cache;
+
+  if (reflected_call.m_call_cache_epoch == ms_call_cache_epoch)
+    {
+    for (uint32_t i = 0u; i < CallCache_size; ++i)
+      {
+      if (cache_p[i].m_class_p == class_scope_p)
+        {
+        return cache_p[i].m_invokable_p;
+        }
+      }
+    }
+  else
+    {
+    // Stale - classes changed since this cache was filled
+    ::memset(cache_p, 0, sizeof(reflected_call.m_call_cache));
+    reflected_call.m_call_cache_epoch = ms_call_cache_epoch;
+    }
+
+  SkInvokableBase * invokable_p;
+
+  if (reflected_call.m_sk_invokable_p->get_invoke_type() == SkInvokable_coroutine)
+    {
+    invokable_p = class_scope_p->find_coroutine_inherited(reflected_call.get_name());
+    }
+  else
+    {
+    invokable_p = (scope == SkScope_instance)
+      ? class_scope_p->find_instance_method_inherited(reflected_call.get_name())
+      : class_scope_p->find_class_method_inherited(reflected_call.get_name());
+    }
+
+  // Only remember successful lookups - failures are reported by the caller
+  if (invokable_p)
+    {
+    // Insert as most recent entry - if all entries are in use the oldest one drops off
+    ::memmove(cache_p + 1, cache_p, (CallCache_size - 1u) * sizeof(CallCacheEntry));
+    cache_p[0].m_class_p     = class_scope_p;
+    cache_p[0].m_invokable_p = invokable_p;
+    }
+
+  return invokable_p;
+  }
+
+#endif  // (SKOOKUM & SK_DEBUG)
+
 //---------------------------------------------------------------------------------------
 
 void SkUEReflectionManager::exec_sk_method(FFrame & stack, void * const result_p, SkClass * class_scope_p, SkInstance * this_p)
   {
-  const ReflectedCall & reflected_call = static_cast<const ReflectedCall &>(*ms_singleton_p->m_reflected_functions[stack.CurrentNativeFunction->RPCId]);
+  ReflectedCall & reflected_call = static_cast<ReflectedCall &>(*ms_singleton_p->m_reflected_functions[stack.CurrentNativeFunction->RPCId]);
   SK_ASSERTX(reflected_call.m_type == ReflectedFunctionType_call, "ReflectedFunction has bad type!");
   SK_ASSERTX(reflected_call.m_sk_invokable_p->get_invoke_type() == SkInvokable_method, "Must be a method at this point.");
 
   SkMethodBase * method_p = static_cast<SkMethodBase *>(reflected_call.m_sk_invokable_p);
   if (method_p->get_scope() != class_scope_p)
     {
-    method_p = static_cast<SkMethodBase *>(class_scope_p->get_invokable_from_vtable(this_p ? SkScope_instance : SkScope_class, method_p->get_vtable_index()));
+    method_p = static_cast<SkMethodBase *>(resolve_reflected_call(reflected_call, class_scope_p, this_p ? SkScope_instance : SkScope_class));
     #if SKOOKUM & SK_DEBUG
-      // If not found, might be due to recent live update and the vtable not being updated yet - try finding it by name
-      if (!method_p || method_p->get_name() != reflected_call.get_name())
-        {
-        method_p = this_p
-          ? class_scope_p->find_instance_method_inherited(reflected_call.get_name())
-          : class_scope_p->find_class_method_inherited(reflected_call.get_name());
-        }
-      // If still not found, that means the method placed in the graph is not in a parent class of class_scope_p
+      // If not found, that means the method placed in the graph is not in a parent class of class_scope_p
       if (!method_p)
         {
         // Just revert to original method and then, after processing the arguments on the stack, assert below
@@ -854,6 +1021,7 @@ void SkUEReflectionManager::exec_sk_method(FFrame & stack, void * const result_p
     }
   SkInvokedMethod imethod(nullptr, this_p ? this_p : &class_scope_p->get_metaclass(), method_p, a_stack_allocate(method_p->get_invoked_data_array_size(), SkInstance*));
 
+  SKUE_PROFILE_SCOPE(method_p);
   SKDEBUG_ICALL_SET_INTERNAL(&imethod);
   SKDEBUG_HOOK_SCRIPT_ENTRY(reflected_call.get_name());
 
@@ -877,15 +1045,20 @@ void SkUEReflectionManager::exec_sk_method(FFrame & stack, void * const result_p
     else
   #endif
       {
-      // Call method
-      SkInstance * result_instance_p = SkBrain::ms_nil_p;
-      static_cast<SkMethod *>(method_p)->SkMethod::invoke(&imethod, nullptr, &result_instance_p); // We know it's a method so call directly
-      // And pass back the result
+      // Call method - we know it's a method so call directly
       if (reflected_call.m_result.m_outer_storer_p)
         {
+        SkInstance * result_instance_p = SkBrain::ms_nil_p;
+        static_cast<SkMethod *>(method_p)->SkMethod::invoke(&imethod, nullptr, &result_instance_p);
+        // And pass back the result
         (*reflected_call.m_result.m_outer_storer_p)(result_p, result_instance_p, reflected_call.m_result);
+        result_instance_p->dereference();
+        }
+      else
+        {
+        // No result wanted by Blueprints so don't have the method create one
+        static_cast<SkMethod *>(method_p)->SkMethod::invoke(&imethod, nullptr, nullptr);
         }
-      result_instance_p->dereference();
       }
 
   SKDEBUG_HOOK_SCRIPT_EXIT();
@@ -912,7 +1085,7 @@ void SkUEReflectionManager::exec_sk_instance_method(FFrame & stack, void * const
 
 void SkUEReflectionManager::exec_sk_coroutine(FFrame & stack, void * const result_p)
   {
-  const ReflectedCall & reflected_call = static_cast<const ReflectedCall &>(*ms_singleton_p->m_reflected_functions[stack.CurrentNativeFunction->RPCId]);
+  ReflectedCall & reflected_call = static_cast<ReflectedCall &>(*ms_singleton_p->m_reflected_functions[stack.CurrentNativeFunction->RPCId]);
   SK_ASSERTX(reflected_call.m_type == ReflectedFunctionType_call, "ReflectedFunction has bad type!");
   SK_ASSERTX(reflected_call.m_sk_invokable_p->get_invoke_type() == SkInvokable_coroutine, "Must be a coroutine at this point.");
 
@@ -924,14 +1097,9 @@ void SkUEReflectionManager::exec_sk_coroutine(FFrame & stack, void * const resul
   SkClass * class_scope_p = this_p->get_class();
   if (coro_p->get_scope() != class_scope_p)
     {
-    coro_p = static_cast<SkCoroutine *>(class_scope_p->get_invokable_from_vtable_i(coro_p->get_vtable_index()));
+    coro_p = static_cast<SkCoroutineBase *>(resolve_reflected_call(reflected_call, class_scope_p, SkScope_instance));
     #if SKOOKUM & SK_DEBUG
-      // If not found, might be due to recent live update and the vtable not being updated yet - try finding it by name
-      if (coro_p == nullptr || coro_p->get_name() != reflected_call.m_sk_invokable_p->get_name())
-        {
-        coro_p = class_scope_p->find_coroutine_inherited(reflected_call.m_sk_invokable_p->get_name());
-        }
-      // If still not found, that means the coroutine placed in the graph is not in a parent class of class_scope_p
+      // If not found, that means the coroutine placed in the graph is not in a parent class of class_scope_p
       if (!coro_p)
         {
         // Just revert to original coroutine and then, after processing the arguments on the stack, assert below
@@ -975,6 +1143,7 @@ void SkUEReflectionManager::exec_sk_coroutine(FFrame & stack, void * const resul
   #endif
       {
       // Invoke the coroutine on this_p - might return immediately
+      SKUE_PROFILE_SCOPE(coro_p);
       icoroutine_p->on_update();
       }
 
@@ -1023,6 +1192,9 @@ void SkUEReflectionManager::mthd_invoke_k2_event(SkInvokedMethod * scope_p, SkIn
   ReflectedEvent * reflected_event_p = static_cast<ReflectedEvent *>(ms_singleton_p->m_reflected_functions[function_index]);
   SK_ASSERTX(reflected_event_p->m_type == ReflectedFunctionType_event, "ReflectedFunction has bad type!");
 
+  SKUE_PROFILE_SCOPE(scope_p->get_invokable());
+  SKUE_PROFILE_SAMPLE(scope_p);
+
   // Perform invocation
   invoke_k2_event(reflected_event_p, scope_p, result_pp, [=](void * k2_params_p)
     {
@@ -1136,6 +1308,9 @@ void SkUEReflectionManager::invoke_k2_delegate(const FScriptDelegate & script_de
       reflected_delegate_p = add_reflected_delegate(sk_params_p, static_cast<const Hacked_FScriptDelegate &>(script_delegate).get_signature());
       }
 
+    SKUE_PROFILE_SCOPE(scope_p->get_invokable());
+    SKUE_PROFILE_SAMPLE(scope_p);
+
     // Perform the actual invocation
     invoke_k2_event(reflected_delegate_p, scope_p, result_pp, [=](void * k2_params_p)
       {
@@ -1158,6 +1333,9 @@ void SkUEReflectionManager::invoke_k2_delegate(const FMulticastScriptDelegate &
       reflected_delegate_p = add_reflected_delegate(sk_params_p, static_cast<const Hacked_FMulticastScriptDelegate &>(script_delegate).get_signature());
       }
 
+    SKUE_PROFILE_SCOPE(scope_p->get_invokable());
+    SKUE_PROFILE_SAMPLE(scope_p);
+
     // Perform the actual invocation
     invoke_k2_event(reflected_delegate_p, scope_p, result_pp, [=](void * k2_params_p)
       {
@@ -1232,6 +1410,7 @@ int32_t SkUEReflectionManager::store_reflected_function(ReflectedFunction * refl
     m_reflected_classes.append(*reflected_class_p);
     }
   reflected_class_p->m_functions.append(FunctionIndex(function_index_to_use));
+  reflected_class_p->m_is_dirty = true; // New function must be exposed by next sync_all_to_ue()
 
   return function_index_to_use;
   }
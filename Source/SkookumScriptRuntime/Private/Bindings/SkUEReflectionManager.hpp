@@ -62,7 +62,10 @@ class SkUEReflectionManager
     void         clear(tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f);
     bool         sync_all_from_sk(tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f);
     bool         sync_class_from_sk(SkClass * sk_class_p, tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f);
+    bool         sync_class_from_sk_recursively(SkClass * sk_class_p, tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f);
     bool         sync_all_to_ue(tSkUEOnFunctionUpdatedFunc * on_function_updated_f, bool is_final);
+    void         mark_class_dirty(SkClass * sk_class_p, bool recursively = true);
+    void         mark_all_dirty();
 
     static bool  does_class_need_instance_property(SkClass * sk_class_p);
     static bool  add_instance_property_to_class(UClass * ue_class_p, SkClass * sk_class_p);
@@ -70,8 +73,14 @@ class SkUEReflectionManager
     static bool  can_ue_property_be_reflected(UProperty * ue_property_p);
 
     static bool  is_skookum_reflected_call(UFunction * function_p);
+    static bool  is_skookum_reflected_method_call(UFunction * function_p);
     static bool  is_skookum_reflected_event(UFunction * function_p);
 
+    #if (SKOOKUM & SK_DEBUG)
+      // Call whenever script routines are loaded or unloaded so cached lookups are redone
+      static void  invalidate_call_caches()   { if (++ms_call_cache_epoch == 0u) { ms_call_cache_epoch = 1u; } }
+    #endif
+
     void         invoke_k2_delegate(const FScriptDelegate & script_delegate, const SkParameters * sk_params_p, SkInvokedMethod * scope_p, SkInstance ** result_pp);
     void         invoke_k2_delegate(const FMulticastScriptDelegate & script_delegate, const SkParameters * sk_params_p, SkInvokedMethod * scope_p, SkInstance ** result_pp);
 
@@ -168,14 +177,33 @@ class SkUEReflectionManager
       ReflectedParamStorer(const ASymbol & name, SkClassDescBase * sk_type_p) : TypedName(name, sk_type_p), m_outer_storer_p(nullptr), m_inner_storer_p(nullptr) {}
       };
 
+    #if (SKOOKUM & SK_DEBUG)
+      // Number of receiver classes remembered per reflected call
+      enum { CallCache_size = 4 };
+
+      // Inline cache entry - maps a receiver class to the invokable found by name
+      struct CallCacheEntry
+        {
+        SkClass *         m_class_p;
+        SkInvokableBase * m_invokable_p;
+        };
+    #endif
+
     // Function binding (call from Blueprints into Sk)
     struct ReflectedCall : public ReflectedFunction
       {
-      ReflectedParamStorer  m_result;
+      ReflectedParamStorer    m_result;
+      #if (SKOOKUM & SK_DEBUG)
+        CallCacheEntry        m_call_cache[CallCache_size]; // Receiver classes seen at this call site, most recent first
+        uint32_t              m_call_cache_epoch;           // Cache is only valid while this equals ms_call_cache_epoch
+      #endif
 
       ReflectedCall(SkInvokableBase * sk_invokable_p, uint32_t num_params, SkClassDescBase * sk_result_type_p)
         : ReflectedFunction(ReflectedFunctionType_call, sk_invokable_p, num_params)
         , m_result(ASymbol::ms_null, sk_result_type_p)
+        #if (SKOOKUM & SK_DEBUG)
+          , m_call_cache_epoch(0u) // Never matches a live epoch
+        #endif
         {}
 
       // The parameter entries are stored behind this structure in memory
@@ -272,12 +300,18 @@ class SkUEReflectionManager
       AVArray<FunctionIndex>  m_functions;          // Indices of reflected member routines
       tReflectedProperties    m_properties;         // Reflected (raw) data members
       bool                    m_store_sk_instance;  // This class must have a USkookumScriptInstanceProperty attached to it
+      bool                    m_is_dirty;           // Must be visited by the next sync_all_to_ue() - cleared once everything in it is exposed
 
-      ReflectedClass(ASymbol name) : ANamed(name), m_store_sk_instance(false) {}
+      ReflectedClass(ASymbol name) : ANamed(name), m_store_sk_instance(false), m_is_dirty(true) {}
       };
 
     typedef APSortedLogicalFree<ReflectedClass, ASymbol> tReflectedClasses;
 
+    static SkInvokableBase * resolve_reflected_call(ReflectedCall & reflected_call, SkClass * class_scope_p, eSkScope scope);
+    #if (SKOOKUM & SK_DEBUG)
+      static SkInvokableBase * find_reflected_call_by_name(ReflectedCall & reflected_call, SkClass * class_scope_p, eSkScope scope);
+    #endif
+
     void                exec_sk_method(FFrame & stack, void * const result_p, SkClass * class_scope_p, SkInstance * this_p);
     void                exec_sk_class_method(FFrame & stack, void * const result_p);
     void                exec_sk_instance_method(FFrame & stack, void * const result_p);
@@ -292,13 +326,13 @@ class SkUEReflectionManager
     static void         mthd_struct_dtor(SkInvokedMethod * scope_p, SkInstance ** result_pp);
     static void         mthd_struct_op_assign(SkInvokedMethod * scope_p, SkInstance ** result_pp);
 
-    bool                sync_class_from_sk_recursively(SkClass * sk_class_p, tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f);
     bool                try_add_reflected_function(SkInvokableBase * sk_invokable_p);
     bool                try_update_reflected_function(SkInvokableBase * sk_invokable_p, ReflectedClass ** out_reflected_class_pp, int32_t * out_function_index_p);
     bool                add_reflected_call(SkInvokableBase * sk_invokable_p);
     bool                add_reflected_event(SkMethodBase * sk_method_p);
     ReflectedDelegate * add_reflected_delegate(const SkParameters * sk_params_p, UFunction * ue_function_p);
     bool                expose_reflected_function(uint32_t i, tSkUEOnFunctionUpdatedFunc * on_function_updated_f, bool is_final);
+    bool                expose_reflected_class(ReflectedClass * reflected_class_p, tSkUEOnFunctionUpdatedFunc * on_function_updated_f, bool is_final);
     int32_t             store_reflected_function(ReflectedFunction * reflected_function_p, ReflectedClass * reflected_class_p, int32_t function_index_to_use);
     void                delete_reflected_function(uint32_t function_index);
     static UFunction *  find_ue_function(SkInvokableBase * sk_invokable_p);
@@ -400,6 +434,10 @@ class SkUEReflectionManager
     UPackage *            m_module_package_p;
 
     static SkUEReflectionManager * ms_singleton_p; // Hack, make it easy to access for callbacks
+
+    #if (SKOOKUM & SK_DEBUG)
+      static uint32_t       ms_call_cache_epoch; // Bumped whenever Sk classes change so all call site caches are flushed
+    #endif
         
     static UScriptStruct *  ms_struct_vector2_p;
     static UScriptStruct *  ms_struct_vector3_p;
@@ -147,6 +147,7 @@ namespace
 SkUERemote::SkUERemote(FSkookumScriptRuntimeGenerator * runtime_generator_p) :
   m_socket_p(nullptr),
   m_data_idx(ADef_uint32),
+  m_data_out_idx(0),
   m_editor_interface_p(nullptr),
   m_runtime_generator_p(runtime_generator_p),
   m_last_connected_to_ide(false),
@@ -237,6 +238,95 @@ void SkUERemote::process_incoming()
     } // While connected and has data
   }
 
+//---------------------------------------------------------------------------------------
+// Sends as much queued command data as the socket accepts without blocking - anything
+// left over is resumed on the next call.
+// 
+// #Returns false if the connection failed (and was closed) true otherwise
+bool SkUERemote::process_outgoing()
+  {
+  while (m_data_out_idx < m_data_out.Num())
+    {
+    int32 bytes_sent = 0;
+
+    if (!is_connected()
+      || !m_socket_p->Send(m_data_out.GetData() + m_data_out_idx, m_data_out.Num() - m_data_out_idx, bytes_sent))
+      {
+      if (is_connected()
+        && ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK)
+        {
+        // Socket buffer is full - try again later
+        break;
+        }
+
+      ADebug::print("SkookumScript: Lost connection to remote IDE while sending!\n", false);
+      set_mode(SkLocale_embedded);
+
+      return false;
+      }
+
+    if (bytes_sent <= 0)
+      {
+      break;
+      }
+
+    m_data_out_idx += bytes_sent;
+    }
+
+  if (m_data_out_idx == m_data_out.Num())
+    {
+    // Everything sent - keep the buffer for the next command
+    m_data_out.Reset();
+    m_data_out_idx = 0;
+    }
+  else if (m_data_out_idx >= m_data_out.Num() / 2)
+    {
+    // Discard sent data once it is the larger part so moving the rest stays cheap
+    m_data_out.RemoveAt(0, m_data_out_idx, false);
+    m_data_out_idx = 0;
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Sends all queued command data - waiting for the socket as needed.
+// 
+// #Returns false if the connection failed or the time out expired (the connection is
+// then closed) true otherwise
+bool SkUERemote::flush_outgoing(double time_out_seconds)
+  {
+  double time_out_at = get_elapsed_seconds() + time_out_seconds;
+
+  while (process_outgoing())
+    {
+    if (m_data_out_idx == m_data_out.Num())
+      {
+      return true;
+      }
+
+    if (get_elapsed_seconds() >= time_out_at)
+      {
+      ADebug::print("SkookumScript: Remote IDE stopped receiving - disconnecting!\n", false);
+      set_mode(SkLocale_embedded);
+
+      return false;
+      }
+
+    m_socket_p->Wait(ESocketWaitConditions::WaitForWrite, FTimespan::FromMilliseconds(100.0));
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// Discards all command data not sent yet
+void SkUERemote::clear_outgoing()
+  {
+  m_data_out.Empty();
+  m_data_out_idx = 0;
+  }
+
 //---------------------------------------------------------------------------------------
 // Get (ANSI) string representation of specified socket IP Address and port
 // 
@@ -374,6 +464,9 @@ void SkUERemote::set_mode(eSkLocale mode)
       m_socket_p = NULL;
       }
 
+    // Unsent commands are meaningless to a new connection
+    clear_outgoing();
+
 
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // Start new mode
@@ -419,6 +512,10 @@ void SkUERemote::set_mode(eSkLocale mode)
 
         ADebug::print(a_str_format("SkookumScript: Connected %s\n", get_socket_str().as_cstr()), false);
 
+        // Connect blocking but from now on never stall the game thread on the socket -
+        // commands are queued and sent by process_outgoing()
+        m_socket_p->SetNonBlocking(true);
+
         set_connect_state(ConnectState_authenticating);
         break;
         }
@@ -438,22 +535,29 @@ SkRemoteBase::eSendResponse SkUERemote::on_cmd_send(const ADatum & datum)
   {
   if (is_connected())
     {
-    int32 bytes_sent = 0;
+    // Too much still waiting to be sent? Wait for the IDE to catch up rather than queue
+    // without limit.
+    bool success = (m_data_out.Num() - m_data_out_idx + int32(datum.get_length()) <= SendQueue_bytes_max)
+      || flush_outgoing(10.0);
 
-    // $Note - CReis Assumes that Send() is able to transfer entire datum in 1 pass.
-    m_socket_p->Send(datum.get_buffer(), datum.get_length(), bytes_sent);
+    if (success)
+      {
+      // Queue and send as much as possible right away - the rest follows from process_outgoing()
+      m_data_out.Append(datum.get_buffer(), datum.get_length());
+      success = process_outgoing();
+      }
 
     // Did sending go wrong?
-    if (bytes_sent <= 0)
+    if (!success)
       {
       // Reconnect
-      set_mode(SkLocale_embedded);
       ensure_connected(5.0);
 
       // Try again
-      if (m_socket_p)
+      if (is_connected())
         {
-        m_socket_p->Send(datum.get_buffer(), datum.get_length(), bytes_sent);
+        m_data_out.Append(datum.get_buffer(), datum.get_length());
+        process_outgoing();
         }
 
       return SendResponse_Reconnecting;
@@ -517,6 +621,7 @@ void SkUERemote::on_class_updated(SkClass * class_p)
     tSkUEOnFunctionUpdatedFunc *          on_function_updated_f            = nullptr;
     tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f = nullptr;
   #endif
+  // Only classes whose reflected routines actually changed get marked dirty and are re-exposed
   SkUEReflectionManager::get()->sync_class_from_sk(class_p, on_function_removed_from_class_f);
   SkUEReflectionManager::get()->sync_all_to_ue(on_function_updated_f, true);
   }
@@ -550,6 +655,7 @@ double SkUERemote::get_elapsed_seconds()
 void SkUERemote::wait_for_update()
   {
   FPlatformProcess::Sleep(.1f);
+  process_outgoing();
   process_incoming();
   }
 
@@ -61,6 +61,7 @@ class SkUERemote : public SkRemoteRuntimeBase
     ~SkUERemote();
 
     void                      process_incoming();
+    bool                      process_outgoing();
 
     TSharedPtr<FInternetAddr> get_ip_address_local();
     TSharedPtr<FInternetAddr> get_ip_address_ide();
@@ -121,6 +122,20 @@ class SkUERemote : public SkRemoteRuntimeBase
 
   protected:
 
+  // Internal Structures
+
+    enum
+      {
+      // Once this many bytes are waiting to be sent, further commands wait for the
+      // SkookumIDE to catch up rather than being queued
+      SendQueue_bytes_max = 32 * 1024 * 1024
+      };
+
+  // Internal Methods
+
+    bool                      flush_outgoing(double time_out_seconds);
+    void                      clear_outgoing();
+
     AString                   get_socket_str(const FInternetAddr & addr);
     AString                   get_socket_str();
 
@@ -142,6 +157,12 @@ class SkUERemote : public SkRemoteRuntimeBase
     // Data byte index point - ADef_uint32 when not in progress
     uint32_t      m_data_idx;
 
+    // Commands (in datum form) not yet accepted by the socket - sent by process_outgoing()
+    TArray<uint8> m_data_out;
+
+    // Index of first byte in m_data_out not yet sent
+    int32         m_data_out_idx;
+
     // Editor interface so we can notify it about interesting events
     ISkookumScriptRuntimeEditorInterface * m_editor_interface_p;
 
@@ -30,8 +30,11 @@
 #include "SkUEBindings.hpp"
 #include "SkUEClassBinding.hpp"
 #include "SkUEUtils.hpp"
+#include "SkUEProfiler.hpp"
 
 #include "GenericPlatformProcess.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Async/MappedFileHandle.h"
 #include "UObject/UObjectHash.h"
 #include "UObject/UObjectIterator.h"
 #include "Engine/Blueprint.h"
@@ -39,6 +42,7 @@
 #include <chrono>
 
 #include <AgogCore/AMethodArg.hpp>
+#include <SkookumScript/SkActorClass.hpp>
 #include <SkookumScript/SkClass.hpp>
 #include <SkookumScript/SkParser.hpp>
 #include "Engine/SkUEName.hpp"
@@ -53,17 +57,75 @@ namespace
 
   //---------------------------------------------------------------------------------------
   // Custom Unreal Binary Handle Structure
+  // 
+  // Memory maps the binary file if the platform supports it so that it is paged in
+  // directly from the file rather than being copied into a separately allocated buffer.
+  // Otherwise it falls back to reading the file into an allocated buffer.
   struct SkBinaryHandleUE : public SkBinaryHandle
     {
     // Public Methods
 
       //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-      SkBinaryHandleUE(void * binary_p, uint32_t size) : SkBinaryHandle(binary_p, size)
+      SkBinaryHandleUE(void * binary_p, uint32_t size) : SkBinaryHandle(binary_p, size), m_mapped_file_p(nullptr), m_mapped_region_p(nullptr)
         {
         }
 
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      SkBinaryHandleUE(IMappedFileHandle * mapped_file_p, IMappedFileRegion * mapped_region_p)
+        : SkBinaryHandle(const_cast<uint8 *>(mapped_region_p->GetMappedPtr()), (uint32_t)mapped_region_p->GetMappedSize())
+        , m_mapped_file_p(mapped_file_p)
+        , m_mapped_region_p(mapped_region_p)
+        {
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      virtual ~SkBinaryHandleUE() override
+        {
+        if (m_mapped_region_p)
+          {
+          // Region must be released before the file handle it was mapped from
+          delete m_mapped_region_p;
+          delete m_mapped_file_p;
+          }
+        else
+          {
+          FMemory::Free(m_binary_p);
+          }
+        }
+
       //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
       static SkBinaryHandleUE * create(const TCHAR * path_p)
+        {
+        SkBinaryHandleUE * handle_p = create_mapped(path_p);
+
+        return handle_p ? handle_p : create_read(path_p);
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Returns nullptr if the platform does not support memory mapped files
+      static SkBinaryHandleUE * create_mapped(const TCHAR * path_p)
+        {
+        IMappedFileHandle * mapped_file_p = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(path_p);
+        if (!mapped_file_p)
+          {
+          return nullptr;
+          }
+
+        // The whole binary is parsed straight away so hint that it should be preloaded
+        IMappedFileRegion * mapped_region_p = (mapped_file_p->GetFileSize() > 0)
+          ? mapped_file_p->MapRegion(0, mapped_file_p->GetFileSize(), true)
+          : nullptr;
+        if (!mapped_region_p)
+          {
+          delete mapped_file_p;
+          return nullptr;
+          }
+
+        return new SkBinaryHandleUE(mapped_file_p, mapped_region_p);
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      static SkBinaryHandleUE * create_read(const TCHAR * path_p)
         {
         FArchive * reader_p = IFileManager::Get().CreateFileReader(path_p);
         if (!reader_p)
@@ -95,12 +157,19 @@ namespace
 
         if (!success)
           {
-          delete binary_p;
+          FMemory::Free(binary_p);
           return nullptr;
           }
 
         return new SkBinaryHandleUE(binary_p, (uint32_t)size);
         }
+
+    // Data Members
+
+      // Set if binary is memory mapped rather than read into allocated memory
+      IMappedFileHandle * m_mapped_file_p;
+      IMappedFileRegion * m_mapped_region_p;
+
     };
 
 
@@ -119,6 +188,11 @@ SkUERuntime::SkUERuntime()
   , m_have_game_module(false)
   , m_compiled_file_b(false)
   , m_listener_manager(256, 256)
+  , m_demand_unload_idle_secs(0.0)
+  , m_demand_unload_next_check(0.0)
+  , m_demand_used_class_p(nullptr)
+  , m_demand_used_root_p(nullptr)
+  , m_demand_used_time_p(nullptr)
   , m_project_generated_bindings_p(nullptr)
   , m_editor_interface_p(nullptr)
   {
@@ -142,8 +216,8 @@ void SkUERuntime::startup()
     SkDebug::register_print_with_agog();
   #endif
 
-  SkBrain::ms_entity_class_name    = ASymbol::create("Entity");
-  SkBrain::ms_component_class_name = ASymbol::create("SkookumScriptBehaviorComponent");
+  SkBrain::ms_entity_class_name    = ASYMBOL_LITERAL("Entity");
+  SkBrain::ms_component_class_name = ASYMBOL_LITERAL("SkookumScriptBehaviorComponent");
 
   SkBrain::register_bind_atomics_func(SkRuntimeBase::bind_routines);
   SkClass::register_raw_resolve_func(SkUEClassBindingHelper::resolve_raw_data_static);
@@ -169,6 +243,12 @@ void SkUERuntime::shutdown()
     SkRemoteBase::ms_default_p->set_mode(SkLocale_embedded);
   #endif
 
+  #if defined(SKUE_PROFILER)
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Stop profiling before the invokables it refers to go away
+    SkUEProfiler::deinitialize();
+  #endif
+
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Clears out Blueprint interface mappings
   SkUEReflectionManager::get()->clear(nullptr);
@@ -357,6 +437,10 @@ bool SkUERuntime::load_compiled_scripts()
 
   A_DPRINT("\nSkookumScript loading previously parsed compiled binary...\n");
 
+  // Any previously loaded classes are replaced
+  m_demand_loaded_roots.Reset();
+  m_demand_used_class_p = nullptr;
+
   if (load_compiled_hierarchy() != SkLoadStatus_ok)
     {
     return false;
@@ -417,7 +501,9 @@ void SkUERuntime::bind_compiled_scripts(
   // Did we just hot reload?
   if (is_hot_reload)
     {
-    // Yes, sync all reflected types/variables/routines to UE
+    // Yes, sync all reflected types/variables/routines to UE - all of them since the
+    // UE4 classes of clean ones may have been replaced by the reload
+    m_reflection_manager.mark_all_dirty();
     sync_all_reflected_to_ue(true);
     
     // Also re-resolve the raw data of all dynamic classes and structs
@@ -577,3 +663,167 @@ void SkUERuntime::release_binary(SkBinaryHandle * handle_p)
   {
   delete static_cast<SkBinaryHandleUE *>(handle_p);
   }
+
+//---------------------------------------------------------------------------------------
+// Loads the members of a demand loaded class group, exposes its reflected routines and
+// starts tracking its use so it can be unloaded again once idle.
+// 
+// #Modifiers:  virtual - overridden from SkRuntimeBase
+void SkUERuntime::load_compiled_class_group(SkClass * class_p)
+  {
+  SkRuntimeBase::load_compiled_class_group(class_p);
+  sync_reflected_class_group(class_p);
+
+  if (class_p->is_loaded())
+    {
+    // Adding may move the times of the other groups
+    m_demand_used_class_p = nullptr;
+    m_demand_loaded_roots.Add(class_p, FPlatformTime::Seconds());
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Ensures the demand loaded class group that the specified class belongs to is loaded
+// and marks it as recently used.
+// 
+// #Params
+//   class_p: class that is about to get an instance or have one of its routines invoked
+void SkUERuntime::use_demand_loaded_class(SkClass * class_p)
+  {
+  // Same class as last time and its group is still loaded - just a store
+  if ((class_p == m_demand_used_class_p) && m_demand_used_root_p->is_loaded())
+    {
+    *m_demand_used_time_p = FPlatformTime::Seconds();
+    return;
+    }
+
+  SkClass * root_p = class_p->is_demand_loaded_root() ? class_p : class_p->get_demand_loaded_root();
+
+  if (!root_p)
+    {
+    return;
+    }
+
+  if (!root_p->is_loaded())
+    {
+    A_DPRINT("SkookumScript demand loading class group '%s'...\n", root_p->get_name_cstr_dbg());
+    load_compiled_class_group(root_p);
+    return;
+    }
+
+  f64 * last_used_p = m_demand_loaded_roots.Find(root_p);
+
+  if (last_used_p)
+    {
+    *last_used_p = FPlatformTime::Seconds();
+    m_demand_used_class_p = class_p;
+    m_demand_used_root_p  = root_p;
+    m_demand_used_time_p  = last_used_p;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Unloads demand loaded class groups that have not been used for longer than the
+// demand unload idle time and have no live instances.  Cheap to call every frame - it
+// only checks periodically.
+void SkUERuntime::update_demand_loaded_classes()
+  {
+  if ((m_demand_unload_idle_secs <= 0.0) || (m_demand_loaded_roots.Num() == 0))
+    {
+    return;
+    }
+
+  f64 now = FPlatformTime::Seconds();
+
+  if (now < m_demand_unload_next_check)
+    {
+    return;
+    }
+
+  // No need to check more often than a fraction of the idle time
+  m_demand_unload_next_check = now + FMath::Min(m_demand_unload_idle_secs * 0.25, 10.0);
+
+  for (auto root_it = m_demand_loaded_roots.CreateIterator(); root_it; ++root_it)
+    {
+    SkClass * root_p = root_it.Key();
+
+    if ((now - root_it.Value() >= m_demand_unload_idle_secs)
+      && !root_p->is_load_locked()
+      && !is_class_group_in_use(root_p))
+      {
+      // Use must go through the lookups again so a deferred unload is noticed
+      m_demand_used_class_p = nullptr;
+
+      // If it is still in use the class defers the unload until it is possible and stays
+      // tracked until then.
+      if (root_p->demand_unload() || !root_p->is_loaded())
+        {
+        A_DPRINT("SkookumScript unloaded idle class group '%s'.\n", root_p->get_name_cstr_dbg());
+        sync_reflected_class_group(root_p);
+        root_it.RemoveCurrent();
+        }
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines if instances of a class or any of its subclasses may still exist.
+// Actor instances are tracked by their class and instances of classes with a UE4
+// counterpart live in UObjects.  Instances of other classes cannot be tracked so they
+// always count as in use and groups containing them are never unloaded.
+bool SkUERuntime::is_class_group_in_use(SkClass * class_p) const
+  {
+  if (class_p->is_actor_class())
+    {
+    if (static_cast<SkActorClass *>(class_p)->get_instances().is_filled())
+      {
+      return true;
+      }
+    }
+  else
+    {
+    UClass * ue_class_p = class_p->is_entity_class() ? SkUEClassBindingHelper::get_ue_class_from_sk_class(class_p) : nullptr;
+
+    if (!ue_class_p)
+      {
+      return true;
+      }
+
+    TArray<UObject *> objects;
+
+    GetObjectsOfClass(ue_class_p, objects, false, RF_ClassDefaultObject);
+
+    if (objects.Num())
+      {
+      return true;
+      }
+    }
+
+  for (SkClass * subclass_p : class_p->get_subclasses())
+    {
+    if (is_class_group_in_use(subclass_p))
+      {
+      return true;
+      }
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// Updates the reflected routines of a demand loaded class group after it was loaded or
+// unloaded so no reflected call refers to routines that are gone.
+void SkUERuntime::sync_reflected_class_group(SkClass * root_p)
+  {
+  #if WITH_EDITOR
+    AMethodArg2<ISkookumScriptRuntimeEditorInterface, UFunction*, bool> editor_on_function_updated_f(m_editor_interface_p, &ISkookumScriptRuntimeEditorInterface::on_function_updated);
+    AMethodArg<ISkookumScriptRuntimeEditorInterface, UClass*>           editor_on_function_removed_from_class_f(m_editor_interface_p, &ISkookumScriptRuntimeEditorInterface::on_function_removed_from_class);
+    tSkUEOnFunctionUpdatedFunc *          on_function_updated_f            = &editor_on_function_updated_f;
+    tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f = &editor_on_function_removed_from_class_f;
+  #else
+    tSkUEOnFunctionUpdatedFunc *          on_function_updated_f            = nullptr;
+    tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f = nullptr;
+  #endif
+  m_reflection_manager.sync_class_from_sk_recursively(root_p, on_function_removed_from_class_f);
+  m_reflection_manager.sync_all_to_ue(on_function_updated_f, true);
+  }
@@ -75,6 +75,14 @@ class SkUERuntime :
       void sync_all_reflected_from_sk();
       void sync_all_reflected_to_ue(bool is_final);
 
+    // Demand Loading
+
+      void use_demand_loaded_class(SkClass * class_p);
+      void update_demand_loaded_classes();
+      bool is_class_group_in_use(SkClass * class_p) const;
+      void sync_reflected_class_group(SkClass * root_p);
+      void set_demand_unload_idle_time(f64 idle_secs)  { m_demand_unload_idle_secs = idle_secs; }
+
     // Overridden from SkRuntimeBase
 
       // Binary Serialization / Loading Overrides
@@ -84,6 +92,7 @@ class SkUERuntime :
         virtual SkBinaryHandle * get_binary_hierarchy() override;
         virtual SkBinaryHandle * get_binary_class_group(const SkClass & cls) override;
         virtual void             release_binary(SkBinaryHandle * handle_p) override;
+        virtual void             load_compiled_class_group(SkClass * class_p) override;
 
         #if defined(A_SYMBOL_STR_DB_AGOG)  
           virtual SkBinaryHandle * get_binary_symbol_table() override;
@@ -125,6 +134,24 @@ class SkUERuntime :
       SkookumScriptListenerManager m_listener_manager;
       SkUEReflectionManager        m_reflection_manager;
 
+      // Roots of demand loaded class groups that are currently loaded along with the
+      // time (in seconds) they were last used
+      TMap<SkClass *, f64> m_demand_loaded_roots;
+
+      // Time (in seconds) a demand loaded class group may go unused before it is unloaded
+      // - 0 to never unload
+      f64 m_demand_unload_idle_secs;
+
+      // Time (in seconds) when m_demand_loaded_roots should next be checked for idle groups
+      f64 m_demand_unload_next_check;
+
+      // Most recently used class of a demand loaded group, the root of that group and its
+      // entry in m_demand_loaded_roots so repeated use of the same class skips the lookups
+      // - reset whenever the map changes or an unload is requested
+      SkClass * m_demand_used_class_p;
+      SkClass * m_demand_used_root_p;
+      f64 *     m_demand_used_time_p;
+
       SkUEBindingsInterface *                 m_project_generated_bindings_p;
       ISkookumScriptRuntimeEditorInterface *  m_editor_interface_p;
 
@@ -0,0 +1,479 @@
+//=======================================================================================
+// Copyright (c) 2001-2017 Agog Labs Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=======================================================================================
+
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+//
+// Size class slab allocator for small AgogCore/SkookumScript allocations
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "SkUESlabAllocator.hpp"
+
+#include "HAL/UnrealMemory.h"
+
+#include <AgogCore/ADebug.hpp>
+
+
+//=======================================================================================
+// Class Data
+//=======================================================================================
+
+const uint8_t SkUESlabAllocator::ms_size_to_class[Size_max / Alignment + 1] =
+  {
+  0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 9, 10, 10, 11, 11,
+  12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15
+  };
+
+const uint16_t SkUESlabAllocator::ms_class_sizes[Size_class_count] =
+  {
+  16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512
+  };
+
+// No constructor so zero initialized before any dynamic initialization
+SkUESlabAllocator SkUESlabAllocator::ms_singleton;
+
+
+//=======================================================================================
+// Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Allocates memory
+// Returns:    memory aligned to Alignment bytes or nullptr if out of memory
+// Arg         size - number of bytes needed
+// Arg         debug_name_p - name describing the allocation (for statistics only)
+void * SkUESlabAllocator::allocate(size_t size, const char * debug_name_p)
+  {
+  if (size > Size_max)
+    {
+    return FMemory::Malloc(size, Alignment);
+    }
+
+  uint32_t    class_idx  = ms_size_to_class[(size + Alignment - 1u) / Alignment];
+  SizeClass & size_class = m_classes[class_idx];
+
+  lock(size_class.m_lock);
+
+  Page * page_p = size_class.m_pages_p;
+
+  if (!page_p)
+    {
+    page_p = take_page(class_idx);
+
+    if (!page_p)
+      {
+      unlock(size_class.m_lock);
+      return nullptr;
+      }
+
+    list_append(&size_class.m_pages_p, page_p);
+    size_class.m_stats.m_page_count++;
+    }
+
+  void * mem_p;
+
+  if (page_p->m_free_p)
+    {
+    mem_p = page_p->m_free_p;
+    page_p->m_free_p = page_p->m_free_p->m_next_p;
+    }
+  else
+    {
+    mem_p = page_p->m_bump_p;
+    page_p->m_bump_p += ms_class_sizes[class_idx];
+    }
+
+  page_p->m_used_count++;
+
+  // Full pages are dropped from the list until something in them is freed
+  if (!page_p->m_free_p && (page_p->m_bump_p == page_p->m_bump_end_p))
+    {
+    list_remove(&size_class.m_pages_p, page_p);
+    }
+
+  SizeClassStats & stats = size_class.m_stats;
+
+  if (++stats.m_count_now > stats.m_count_max)
+    {
+    stats.m_count_max = stats.m_count_now;
+    }
+
+  #ifdef SKUE_SLAB_TAG_STATS
+    if (debug_name_p)
+      {
+      lock(m_tags_lock);
+
+      // Open addressing keyed on the address of the name - names are string literals
+      uint32_t tag_idx = uint32_t(uintptr_t(debug_name_p) >> 3u);
+
+      for (uint32_t probe = 0u; probe < TagStats_count; probe++, tag_idx++)
+        {
+        TagStats & tag = m_tags[tag_idx & (TagStats_count - 1u)];
+
+        if (tag.m_name_p == debug_name_p || !tag.m_name_p)
+          {
+          tag.m_name_p = debug_name_p;
+          tag.m_count++;
+          tag.m_bytes += ms_class_sizes[class_idx];
+          break;
+          }
+        }
+
+      unlock(m_tags_lock);
+      }
+  #endif
+
+  unlock(size_class.m_lock);
+
+  return mem_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees memory obtained from allocate() - or from FMemory directly
+void SkUESlabAllocator::deallocate(void * mem_p)
+  {
+  if (!mem_p)
+    {
+    return;
+    }
+
+  if (!is_owned(mem_p))
+    {
+    FMemory::Free(mem_p);
+    return;
+    }
+
+  // The page cannot change size class while mem_p is still in use
+  Page *      page_p     = reinterpret_cast<Page *>(uintptr_t(mem_p) & ~uintptr_t(Page_size - 1));
+  SizeClass & size_class = m_classes[page_p->m_class_idx];
+  FreeNode *  node_p     = static_cast<FreeNode *>(mem_p);
+
+  lock(size_class.m_lock);
+
+  bool was_full = !page_p->m_free_p && (page_p->m_bump_p == page_p->m_bump_end_p);
+
+  node_p->m_next_p = page_p->m_free_p;
+  page_p->m_free_p = node_p;
+  page_p->m_used_count--;
+  size_class.m_stats.m_count_now--;
+
+  if (was_full)
+    {
+    list_append(&size_class.m_pages_p, page_p);
+    }
+
+  // Keep the last page with room so a size class that repeatedly allocates and frees a
+  // single allocation does not keep taking and releasing a page
+  if (page_p->m_used_count || ((size_class.m_pages_p == page_p) && !page_p->m_next_p))
+    {
+    unlock(size_class.m_lock);
+    return;
+    }
+
+  list_remove(&size_class.m_pages_p, page_p);
+  size_class.m_stats.m_page_count--;
+
+  // Still under the size class lock so a page is never in two lists at once
+  release_page(page_p);
+
+  unlock(size_class.m_lock);
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines if memory was allocated from one of the pages of this allocator
+// Notes:      Does not lock - only valid for memory that is still allocated
+bool SkUESlabAllocator::is_owned(const void * mem_p) const
+  {
+  uintptr_t page_num = uintptr_t(mem_p) >> Page_size_log2;
+  uintptr_t root_idx = page_num >> Map_leaf_bits;
+
+  if (root_idx >= Map_root_count)
+    {
+    return false;
+    }
+
+  const std::atomic<uint8_t> * leaf_p = m_map[root_idx].load(std::memory_order_acquire);
+
+  return leaf_p && leaf_p[page_num & (Map_leaf_count - 1)].load(std::memory_order_relaxed);
+  }
+
+//---------------------------------------------------------------------------------------
+// Copies usage of each size class to stats_p which must have room for Size_class_count
+// entries
+void SkUESlabAllocator::get_stats(SizeClassStats * stats_p) const
+  {
+  for (uint32_t class_idx = 0u; class_idx < Size_class_count; class_idx++)
+    {
+    const SizeClass & size_class = m_classes[class_idx];
+
+    lock(size_class.m_lock);
+    stats_p[class_idx] = size_class.m_stats;
+    unlock(size_class.m_lock);
+
+    stats_p[class_idx].m_byte_size = ms_class_sizes[class_idx];
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Prints usage of all size classes (and of all debug names if tracked) to the debug
+// output
+void SkUESlabAllocator::print_stats() const
+  {
+  SizeClassStats stats[Size_class_count];
+
+  get_stats(stats);
+
+  lock(m_pages_lock);
+  uint32_t block_count = m_block_count;
+  uint32_t empty_count = m_empty_page_count;
+  unlock(m_pages_lock);
+
+  ADebug::print_format("\nSlab allocator - %u blocks of %u KB, %u empty pages\n", block_count, (Pages_per_block * Page_size) >> 10u, empty_count);
+  ADebug::print_format("  %5s %8s %8s %6s\n", "Size", "Used", "Peak", "Pages");
+
+  for (uint32_t class_idx = 0u; class_idx < Size_class_count; class_idx++)
+    {
+    const SizeClassStats & class_stats = stats[class_idx];
+
+    ADebug::print_format("  %5u %8u %8u %6u\n", class_stats.m_byte_size, class_stats.m_count_now, class_stats.m_count_max, class_stats.m_page_count);
+    }
+
+  #ifdef SKUE_SLAB_TAG_STATS
+    ADebug::print_format("  %-32s %10s %12s\n", "Allocated by", "Count", "Bytes");
+
+    lock(m_tags_lock);
+
+    for (uint32_t tag_idx = 0u; tag_idx < TagStats_count; tag_idx++)
+      {
+      const TagStats & tag = m_tags[tag_idx];
+
+      if (tag.m_name_p)
+        {
+        ADebug::print_format("  %-32s %10u %12llu\n", tag.m_name_p, tag.m_count, (unsigned long long)tag.m_bytes);
+        }
+      }
+
+    unlock(m_tags_lock);
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Assigns an empty page to a size class - getting a new block of pages from FMemory if
+// there are no empty pages.
+// Returns:    page or nullptr if out of memory
+// Notes:      Called with the lock of the size class held
+SkUESlabAllocator::Page * SkUESlabAllocator::take_page(uint32_t class_idx)
+  {
+  static_assert(sizeof(Page) <= Page_header_size, "Page bookkeeping must fit in the page header!");
+
+  lock(m_pages_lock);
+
+  Page * page_p = m_empty_pages_p;
+
+  if (!page_p)
+    {
+    Block * block_p = new_block();
+
+    if (!block_p)
+      {
+      unlock(m_pages_lock);
+      return nullptr;
+      }
+
+    page_p = m_empty_pages_p;
+    }
+
+  list_remove(&m_empty_pages_p, page_p);
+  page_p->m_block_p->m_empty_count--;
+  m_empty_page_count--;
+
+  unlock(m_pages_lock);
+
+  uint32_t byte_size = ms_class_sizes[class_idx];
+  uint8_t * first_p  = reinterpret_cast<uint8_t *>(page_p) + Page_header_size;
+
+  page_p->m_free_p     = nullptr;
+  page_p->m_bump_p     = first_p;
+  page_p->m_bump_end_p = first_p + ((Page_size - Page_header_size) / byte_size) * byte_size;
+  page_p->m_used_count = 0u;
+  page_p->m_class_idx  = class_idx;
+
+  return page_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns a page that no longer has any allocations to the empty page list - and the
+// block it belongs to to FMemory if all its pages are empty and enough other pages are.
+void SkUESlabAllocator::release_page(Page * page_p)
+  {
+  lock(m_pages_lock);
+
+  Block * block_p = page_p->m_block_p;
+
+  list_append(&m_empty_pages_p, page_p);
+  block_p->m_empty_count++;
+  m_empty_page_count++;
+
+  if ((block_p->m_empty_count == Pages_per_block) && (m_empty_page_count > Pages_empty_max))
+    {
+    free_block(block_p);
+    }
+
+  unlock(m_pages_lock);
+  }
+
+//---------------------------------------------------------------------------------------
+// Gets a block of pages from FMemory and adds all its pages to the empty page list
+// Returns:    block or nullptr if out of memory
+// Notes:      Called with m_pages_lock held
+SkUESlabAllocator::Block * SkUESlabAllocator::new_block()
+  {
+  // Over-allocate by a page so the pages can be aligned to the page size which lets
+  // deallocate() find the page of an address with a mask
+  Block * block_p = static_cast<Block *>(FMemory::Malloc(sizeof(Block)));
+  void *  mem_p   = FMemory::Malloc((Pages_per_block + 1u) * Page_size);
+
+  if (!block_p || !mem_p)
+    {
+    if (block_p) { FMemory::Free(block_p); }
+    if (mem_p)   { FMemory::Free(mem_p); }
+    return nullptr;
+    }
+
+  block_p->m_mem_p       = mem_p;
+  block_p->m_pages_p     = reinterpret_cast<uint8_t *>((uintptr_t(mem_p) + Page_size - 1u) & ~uintptr_t(Page_size - 1u));
+  block_p->m_empty_count = Pages_per_block;
+
+  if (!map_pages(block_p, true))
+    {
+    // Outside of the addresses the page map covers
+    FMemory::Free(mem_p);
+    FMemory::Free(block_p);
+    return nullptr;
+    }
+
+  for (uint32_t page_idx = 0u; page_idx < Pages_per_block; page_idx++)
+    {
+    Page * page_p = reinterpret_cast<Page *>(block_p->m_pages_p + (page_idx << Page_size_log2));
+
+    page_p->m_block_p = block_p;
+    list_append(&m_empty_pages_p, page_p);
+    }
+
+  m_empty_page_count += Pages_per_block;
+  m_block_count++;
+
+  return block_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns a block whose pages are all empty to FMemory
+// Notes:      Called with m_pages_lock held
+void SkUESlabAllocator::free_block(Block * block_p)
+  {
+  for (uint32_t page_idx = 0u; page_idx < Pages_per_block; page_idx++)
+    {
+    list_remove(&m_empty_pages_p, reinterpret_cast<Page *>(block_p->m_pages_p + (page_idx << Page_size_log2)));
+    }
+
+  m_empty_page_count -= Pages_per_block;
+  m_block_count--;
+
+  map_pages(block_p, false);
+  FMemory::Free(block_p->m_mem_p);
+  FMemory::Free(block_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Marks the pages of a block in the page map as belonging to this allocator or not
+// Returns:    false if the pages are outside of the addresses the page map covers or the
+//             map could not be extended
+// Notes:      Called with m_pages_lock held
+bool SkUESlabAllocator::map_pages(const Block * block_p, bool owned)
+  {
+  uintptr_t page_num = uintptr_t(block_p->m_pages_p) >> Page_size_log2;
+
+  for (uint32_t page_idx = 0u; page_idx < Pages_per_block; page_idx++, page_num++)
+    {
+    uintptr_t root_idx = page_num >> Map_leaf_bits;
+
+    if (root_idx >= Map_root_count)
+      {
+      return false;
+      }
+
+    std::atomic<uint8_t> * leaf_p = m_map[root_idx].load(std::memory_order_relaxed);
+
+    if (!leaf_p)
+      {
+      // Only ever added so readers never see a leaf disappear
+      leaf_p = static_cast<std::atomic<uint8_t> *>(FMemory::MallocZeroed(Map_leaf_count * sizeof(std::atomic<uint8_t>)));
+
+      if (!leaf_p)
+        {
+        return false;
+        }
+
+      m_map[root_idx].store(leaf_p, std::memory_order_release);
+      }
+
+    leaf_p[page_num & (Map_leaf_count - 1)].store(owned ? 1u : 0u, std::memory_order_relaxed);
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Adds a page to the front of a doubly linked page list
+void SkUESlabAllocator::list_append(Page ** list_pp, Page * page_p)
+  {
+  page_p->m_prev_p = nullptr;
+  page_p->m_next_p = *list_pp;
+
+  if (*list_pp)
+    {
+    (*list_pp)->m_prev_p = page_p;
+    }
+
+  *list_pp = page_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes a page from a doubly linked page list
+void SkUESlabAllocator::list_remove(Page ** list_pp, Page * page_p)
+  {
+  if (page_p->m_prev_p)
+    {
+    page_p->m_prev_p->m_next_p = page_p->m_next_p;
+    }
+  else
+    {
+    *list_pp = page_p->m_next_p;
+    }
+
+  if (page_p->m_next_p)
+    {
+    page_p->m_next_p->m_prev_p = page_p->m_prev_p;
+    }
+
+  page_p->m_next_p = nullptr;
+  page_p->m_prev_p = nullptr;
+  }
@@ -0,0 +1,252 @@
+//=======================================================================================
+// Copyright (c) 2001-2017 Agog Labs Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=======================================================================================
+
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+//
+// Size class slab allocator for small AgogCore/SkookumScript allocations
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "HAL/PlatformProcess.h"
+
+#include <AgogCore/AgogCore.hpp>
+#include <atomic>
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+#if defined(A_EXTRA_CHECK) && !defined(SKUE_SLAB_NO_TAG_STATS) && !defined(SKUE_SLAB_TAG_STATS)
+  // If this is defined count allocations per debug name passed to allocate()
+  #define SKUE_SLAB_TAG_STATS
+#endif
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Notes    Small allocations (up to Size_max bytes) are rounded up to one of a fixed set
+//          of size classes and served from 64KB pages that each hold allocations of a
+//          single size class.  Pages are carved out of blocks obtained from FMemory.
+//          Larger allocations are passed straight through to FMemory.
+//
+//          Every page keeps its own free list and count of allocations in use.  Pages
+//          that become empty go back to a shared pool for any size class to reuse and
+//          once more than Pages_empty_max pages are empty, blocks that are entirely
+//          empty are returned to FMemory.
+//
+//          Each size class has its own lock so threads only contend when allocating the
+//          same size.  Locks are plain atomic integers (0 = free) rather than
+//          std::atomic_flag since a zero initialized atomic_flag is not guaranteed to be
+//          clear before C++20.  Whether a pointer belongs to a page - and thus its size class -
+//          is found through a page map without taking any lock, so memory allocated
+//          elsewhere (e.g. large allocations) can safely be passed to deallocate().
+//
+//          There is a single instance - get() - which has no constructor or destructor.
+//          It is zero initialized before any code runs and is never destroyed so memory
+//          may be allocated and freed through it at any point in the life of the module.
+class SkUESlabAllocator
+  {
+  public:
+
+  // Nested Structures
+
+    enum
+      {
+      Alignment        = 16,    // All allocations are aligned to this
+      Size_max         = 512,   // Larger allocations go straight to FMemory
+      Size_class_count = 16,
+      Page_size_log2   = 16,
+      Page_size        = 1 << Page_size_log2,  // Each page serves a single size class
+      Page_header_size = 64,    // Page bookkeeping at the start of each page
+      Pages_per_block  = 16,    // Number of pages obtained from FMemory at once
+      Pages_empty_max  = 2 * Pages_per_block  // Empty pages kept before blocks are returned
+      };
+
+    // Usage of a single size class
+    struct SizeClassStats
+      {
+      uint32_t m_byte_size;   // Size of each allocation in this class
+      uint32_t m_count_now;   // Number of allocations currently outstanding
+      uint32_t m_count_max;   // Peak number of allocations outstanding
+      uint32_t m_page_count;  // Number of pages currently assigned to this class
+      };
+
+  // Methods
+
+    void *          allocate(size_t size, const char * debug_name_p);
+    void            deallocate(void * mem_p);
+    bool            is_owned(const void * mem_p) const;
+
+    void            get_stats(SizeClassStats * stats_p) const;
+    void            print_stats() const;
+
+  // Class Methods
+
+    static SkUESlabAllocator & get()  { return ms_singleton; }
+    static uint32_t            request_byte_size(uint32_t size_requested);
+
+  protected:
+
+  // Internal Structures
+
+    struct Block;
+
+    // Spin lock - 0 when free, 1 when held
+    typedef std::atomic<uint32_t> tLock;
+
+    // Free list entry stored in unused allocations
+    struct FreeNode
+      {
+      FreeNode * m_next_p;
+      };
+
+    // Stored at the start of each page - allocations follow it
+    struct Page
+      {
+      FreeNode * m_free_p;      // Allocations in this page that have been freed
+      uint8_t *  m_bump_p;      // Next never used allocation in this page
+      uint8_t *  m_bump_end_p;  // End of the last allocation that fits in this page
+      Page *     m_next_p;      // Next page in size class list or in empty page list
+      Page *     m_prev_p;      // Previous page in size class list or in empty page list
+      Block *    m_block_p;     // Block this page belongs to
+      uint32_t   m_used_count;  // Number of allocations in use
+      uint32_t   m_class_idx;   // Size class this page is assigned to
+      };
+
+    // Pages_per_block consecutive pages
+    struct Block
+      {
+      void *    m_mem_p;        // As returned by FMemory
+      uint8_t * m_pages_p;      // Page aligned start of the pages
+      uint32_t  m_empty_count;  // Number of pages in the empty page list
+      };
+
+    struct SizeClass
+      {
+      // Guards this size class and all the pages assigned to it
+      mutable tLock  m_lock;
+
+      // Pages with room for more allocations - full pages are not tracked
+      Page *         m_pages_p;
+      SizeClassStats m_stats;
+      };
+
+    #ifdef SKUE_SLAB_TAG_STATS
+      // Allocation counts per debug name
+      struct TagStats
+        {
+        const char * m_name_p;
+        uint32_t     m_count;
+        uint64_t     m_bytes;
+        };
+
+      enum { TagStats_count = 256 };  // Must be a power of two
+    #endif
+
+    // Page map - two levels indexed by the page number of an address.  A leaf has one
+    // byte per page which is non-zero if the page belongs to this allocator.
+    enum
+      {
+      Map_leaf_bits  = 18,
+      Map_leaf_count = 1 << Map_leaf_bits,
+      Map_root_bits  = 48 - Page_size_log2 - Map_leaf_bits,  // Covers 48 bit addresses
+      Map_root_count = 1 << Map_root_bits
+      };
+
+  // Internal Methods
+
+    static void   lock(const tLock & lock);
+    static void   unlock(const tLock & lock)  { const_cast<tLock &>(lock).store(0u, std::memory_order_release); }
+
+    Page *        take_page(uint32_t class_idx);
+    void          release_page(Page * page_p);
+    Block *       new_block();
+    void          free_block(Block * block_p);
+    bool          map_pages(const Block * block_p, bool owned);
+
+    static void   list_append(Page ** list_pp, Page * page_p);
+    static void   list_remove(Page ** list_pp, Page * page_p);
+
+  // Data Members
+
+    SizeClass m_classes[Size_class_count];
+
+    // Guards the empty page list and blocks - may be taken while a size class lock is
+    // held but never the other way around
+    mutable tLock m_pages_lock;
+
+    Page *    m_empty_pages_p;
+    uint32_t  m_empty_page_count;
+    uint32_t  m_block_count;
+
+    // Leaves are only ever added so the map can be read without a lock
+    std::atomic<std::atomic<uint8_t> *> m_map[Map_root_count];
+
+    #ifdef SKUE_SLAB_TAG_STATS
+      mutable tLock m_tags_lock;
+      TagStats      m_tags[TagStats_count];
+    #endif
+
+  // Class Data Members
+
+    // Size class index for each 16 byte step from 0 to Size_max bytes
+    static const uint8_t  ms_size_to_class[Size_max / Alignment + 1];
+    static const uint16_t ms_class_sizes[Size_class_count];
+
+    static SkUESlabAllocator ms_singleton;
+
+  };  // SkUESlabAllocator
+
+
+//=======================================================================================
+// Inline Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Acquires a lock - yields to other threads while it is held elsewhere and only retries
+// once it looks free so waiting threads do not keep stealing its cache line.
+inline void SkUESlabAllocator::lock(const tLock & lock)
+  {
+  tLock & lock_ref = const_cast<tLock &>(lock);
+
+  while (lock_ref.exchange(1u, std::memory_order_acquire))
+    {
+    do
+      {
+      FPlatformProcess::Yield();
+      }
+    while (lock_ref.load(std::memory_order_relaxed));
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns the number of bytes that will actually be available for an allocation of the
+// requested size - so callers such as growing arrays can make use of the slack.
+inline uint32_t SkUESlabAllocator::request_byte_size(uint32_t size_requested)
+  {
+  return (size_requested && size_requested <= Size_max)
+    ? ms_class_sizes[ms_size_to_class[(size_requested + Alignment - 1u) / Alignment]]
+    : a_align_up(size_requested, Alignment);
+  }
@@ -29,6 +29,7 @@
 #include "SkVector3.hpp"
 
 #include <SkookumScript/SkBoolean.hpp>
+#include <SkookumScript/SkList.hpp>
 #include <SkookumScript/SkReal.hpp>
 
 //=======================================================================================
@@ -253,6 +254,54 @@ namespace SkRotationAngles_Impl
       }
     }
 
+  //---------------------------------------------------------------------------------------
+  // Bulk operations on lists of rotations
+  // These work directly on the FRotators stored in the list items so no intermediate
+  // instances are created.
+  //---------------------------------------------------------------------------------------
+
+  //---------------------------------------------------------------------------------------
+  // Return list passed in as first argument if result desired
+  static void return_list_arg(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    if (result_pp)
+      {
+      SkInstance * list_p = scope_p->get_arg(SkArg_1);
+      list_p->reference();
+      *result_pp = list_p;
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   RotationAngles@add_assign_all({RotationAngles} rots, RotationAngles rot) {RotationAngles}
+  static void mthdc_add_assign_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+    const FRotator & rot = scope_p->get_arg<SkRotationAngles>(SkArg_2);
+
+    for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+      {
+      (*item_pp)->as<SkRotationAngles>() += rot;
+      }
+
+    return_list_arg(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   RotationAngles@multiply_assign_all({RotationAngles} rots, Real num) {RotationAngles}
+  static void mthdc_multiply_assign_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+    const float num = scope_p->get_arg<SkReal>(SkArg_2);
+
+    for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+      {
+      (*item_pp)->as<SkRotationAngles>() *= num;
+      }
+
+    return_list_arg(scope_p, result_pp);
+    }
+
   //---------------------------------------------------------------------------------------
 
   // Instance method array
@@ -279,6 +328,13 @@ namespace SkRotationAngles_Impl
       { "zero",               mthd_zero },
     };
 
+  // Class method array
+  static const SkClass::MethodInitializerFunc methods_c[] =
+    {
+      { "add_assign_all",      mthdc_add_assign_all },
+      { "multiply_assign_all", mthdc_multiply_assign_all },
+    };
+
   } // namespace
 
 //---------------------------------------------------------------------------------------
@@ -288,6 +344,7 @@ void SkRotationAngles::register_bindings()
   tBindingBase::register_bindings("RotationAngles");
 
   ms_class_p->register_method_func_bulk(SkRotationAngles_Impl::methods_i, A_COUNT_OF(SkRotationAngles_Impl::methods_i), SkBindFlag_instance_no_rebind);
+  ms_class_p->register_method_func_bulk(SkRotationAngles_Impl::methods_c, A_COUNT_OF(SkRotationAngles_Impl::methods_c), SkBindFlag_class_no_rebind);
 
   ms_class_p->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_struct<SkRotationAngles>);
   SkUEClassBindingHelper::resolve_raw_data_struct(ms_class_p, TEXT("Rotator"));
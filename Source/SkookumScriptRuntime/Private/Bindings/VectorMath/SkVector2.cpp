@@ -27,6 +27,8 @@
 #include "SkVector2.hpp"
 
 #include <SkookumScript/SkBoolean.hpp>
+#include <SkookumScript/SkInteger.hpp>
+#include <SkookumScript/SkList.hpp>
 #include <SkookumScript/SkReal.hpp>
 
 //=======================================================================================
@@ -428,6 +430,121 @@ namespace SkVector2_Impl
     }
   */
 
+  //---------------------------------------------------------------------------------------
+  // Bulk operations on lists of vectors
+  // These work directly on the FVector2Ds stored in the list items so no intermediate
+  // instances are created.  With only two components there is nothing to gain from
+  // vector registers so the math is plain.
+  //---------------------------------------------------------------------------------------
+
+  //---------------------------------------------------------------------------------------
+  // Return list passed in as first argument if result desired
+  static void return_list_arg(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    if (result_pp)
+      {
+      SkInstance * list_p = scope_p->get_arg(SkArg_1);
+      list_p->reference();
+      *result_pp = list_p;
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector2@add_assign_all({Vector2} vecs, Vector2 vec) {Vector2}
+  static void mthdc_add_assign_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+    const FVector2D & vec = scope_p->get_arg<SkVector2>(SkArg_2);
+
+    for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+      {
+      (*item_pp)->as<SkVector2>() += vec;
+      }
+
+    return_list_arg(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector2@multiply_assign_all({Vector2} vecs, Real num) {Vector2}
+  static void mthdc_multiply_assign_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+    const float num = scope_p->get_arg<SkReal>(SkArg_2);
+
+    for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+      {
+      (*item_pp)->as<SkVector2>() *= num;
+      }
+
+    return_list_arg(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector2@nearest_index({Vector2} vecs, Vector2 vec) Integer
+  static void mthdc_nearest_index(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+      const FVector2D & vec = scope_p->get_arg<SkVector2>(SkArg_2);
+
+      SkInstance ** items_pp = list.get_array();
+      uint32_t      length   = list.get_length();
+      int32_t       nearest_idx = -1;
+      float         nearest_dist_sq = FLT_MAX;
+      for (uint32_t idx = 0u; idx < length; ++idx)
+        {
+        float dist_sq = FVector2D::DistSquared(items_pp[idx]->as<SkVector2>(), vec);
+        if (dist_sq < nearest_dist_sq)
+          {
+          nearest_dist_sq = dist_sq;
+          nearest_idx     = (int32_t)idx;
+          }
+        }
+
+      *result_pp = SkInteger::new_instance(nearest_idx);
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector2@min_all({Vector2} vecs) Vector2
+  static void mthdc_min_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+      FVector2D min_vec(BIG_NUMBER, BIG_NUMBER);
+
+      for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+        {
+        min_vec = min_vec.ComponentMin((*item_pp)->as<SkVector2>());
+        }
+
+      *result_pp = SkVector2::new_instance(list.get_length() ? min_vec : FVector2D::ZeroVector);
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector2@max_all({Vector2} vecs) Vector2
+  static void mthdc_max_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+      FVector2D max_vec(-BIG_NUMBER, -BIG_NUMBER);
+
+      for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+        {
+        max_vec = max_vec.ComponentMax((*item_pp)->as<SkVector2>());
+        }
+
+      *result_pp = SkVector2::new_instance(list.get_length() ? max_vec : FVector2D::ZeroVector);
+      }
+    }
+
   //---------------------------------------------------------------------------------------
 
   // Instance method array
@@ -469,6 +586,16 @@ namespace SkVector2_Impl
       //{ "normalize",        mthd_normalize },
     };
 
+  // Class method array
+  static const SkClass::MethodInitializerFunc methods_c[] =
+    {
+      { "add_assign_all",      mthdc_add_assign_all },
+      { "multiply_assign_all", mthdc_multiply_assign_all },
+      { "nearest_index",       mthdc_nearest_index },
+      { "min_all",             mthdc_min_all },
+      { "max_all",             mthdc_max_all },
+    };
+
   } // namespace
 
 //---------------------------------------------------------------------------------------
@@ -478,6 +605,7 @@ void SkVector2::register_bindings()
   tBindingBase::register_bindings("Vector2");
 
   ms_class_p->register_method_func_bulk(SkVector2_Impl::methods_i, A_COUNT_OF(SkVector2_Impl::methods_i), SkBindFlag_instance_no_rebind);
+  ms_class_p->register_method_func_bulk(SkVector2_Impl::methods_c, A_COUNT_OF(SkVector2_Impl::methods_c), SkBindFlag_class_no_rebind);
 
   ms_class_p->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_struct<SkVector2>);
   SkUEClassBindingHelper::resolve_raw_data_struct(ms_class_p, TEXT("Vector2D"));
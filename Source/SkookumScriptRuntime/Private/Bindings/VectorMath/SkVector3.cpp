@@ -30,6 +30,8 @@
 #include "SkRotationAngles.hpp"
 
 #include <SkookumScript/SkBoolean.hpp>
+#include <SkookumScript/SkInteger.hpp>
+#include <SkookumScript/SkList.hpp>
 #include <SkookumScript/SkReal.hpp>
 
 //=======================================================================================
@@ -542,6 +544,159 @@ namespace SkVector3_Impl
     }
   */
 
+  //---------------------------------------------------------------------------------------
+  // Bulk operations on lists of vectors
+  // These work directly on the FVectors stored in the list items so no intermediate
+  // instances are created, and use UE4's vector registers (SSE/NEON) for the math.
+  //---------------------------------------------------------------------------------------
+
+  //---------------------------------------------------------------------------------------
+  // Return list passed in as first argument if result desired
+  static void return_list_arg(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    if (result_pp)
+      {
+      SkInstance * list_p = scope_p->get_arg(SkArg_1);
+      list_p->reference();
+      *result_pp = list_p;
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@add_assign_all({Vector3} vecs, Vector3 vec) {Vector3}
+  static void mthdc_add_assign_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+    const VectorRegister vec_reg = VectorLoadFloat3(&scope_p->get_arg<SkVector3>(SkArg_2));
+
+    for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+      {
+      FVector & item = (*item_pp)->as<SkVector3>();
+      VectorStoreFloat3(VectorAdd(VectorLoadFloat3(&item), vec_reg), &item);
+      }
+
+    return_list_arg(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@multiply_assign_all({Vector3} vecs, Real num) {Vector3}
+  static void mthdc_multiply_assign_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+    const VectorRegister num_reg = VectorSetFloat1(scope_p->get_arg<SkReal>(SkArg_2));
+
+    for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+      {
+      FVector & item = (*item_pp)->as<SkVector3>();
+      VectorStoreFloat3(VectorMultiply(VectorLoadFloat3(&item), num_reg), &item);
+      }
+
+    return_list_arg(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@transform_by_all({Vector3} vecs, Transform xform) {Vector3}
+  static void mthdc_transform_by_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+    const FTransform & xform = scope_p->get_arg<SkTransform>(SkArg_2);
+
+    for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+      {
+      FVector & item = (*item_pp)->as<SkVector3>();
+      item = xform.TransformPosition(item);
+      }
+
+    return_list_arg(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@rotate_by_all({Vector3} vecs, Rotation rot) {Vector3}
+  static void mthdc_rotate_by_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+    const FQuat & rot = scope_p->get_arg<SkRotation>(SkArg_2);
+
+    for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+      {
+      FVector & item = (*item_pp)->as<SkVector3>();
+      item = rot.RotateVector(item);
+      }
+
+    return_list_arg(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@nearest_index({Vector3} vecs, Vector3 vec) Integer
+  static void mthdc_nearest_index(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+      const VectorRegister vec_reg = VectorLoadFloat3(&scope_p->get_arg<SkVector3>(SkArg_2));
+
+      SkInstance ** items_pp = list.get_array();
+      uint32_t      length   = list.get_length();
+      int32_t       nearest_idx = -1;
+      float         nearest_dist_sq = FLT_MAX;
+      for (uint32_t idx = 0u; idx < length; ++idx)
+        {
+        VectorRegister diff_reg = VectorSubtract(VectorLoadFloat3(&items_pp[idx]->as<SkVector3>()), vec_reg);
+        float dist_sq = VectorGetComponent(VectorDot3(diff_reg, diff_reg), 0);
+        if (dist_sq < nearest_dist_sq)
+          {
+          nearest_dist_sq = dist_sq;
+          nearest_idx     = (int32_t)idx;
+          }
+        }
+
+      *result_pp = SkInteger::new_instance(nearest_idx);
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@min_all({Vector3} vecs) Vector3
+  static void mthdc_min_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+      VectorRegister min_reg = VectorSetFloat1(BIG_NUMBER);
+
+      for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+        {
+        min_reg = VectorMin(min_reg, VectorLoadFloat3(&(*item_pp)->as<SkVector3>()));
+        }
+
+      FVector min_vec;
+      VectorStoreFloat3(min_reg, &min_vec);
+      *result_pp = SkVector3::new_instance(list.get_length() ? min_vec : FVector::ZeroVector);
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@max_all({Vector3} vecs) Vector3
+  static void mthdc_max_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+      VectorRegister max_reg = VectorSetFloat1(-BIG_NUMBER);
+
+      for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+        {
+        max_reg = VectorMax(max_reg, VectorLoadFloat3(&(*item_pp)->as<SkVector3>()));
+        }
+
+      FVector max_vec;
+      VectorStoreFloat3(max_reg, &max_vec);
+      *result_pp = SkVector3::new_instance(list.get_length() ? max_vec : FVector::ZeroVector);
+      }
+    }
+
   //---------------------------------------------------------------------------------------
 
   // Instance method array
@@ -598,6 +753,18 @@ namespace SkVector3_Impl
       //{ "normalize",        mthd_normalize },
     };
 
+  // Class method array
+  static const SkClass::MethodInitializerFunc methods_c[] =
+    {
+      { "add_assign_all",      mthdc_add_assign_all },
+      { "multiply_assign_all", mthdc_multiply_assign_all },
+      { "rotate_by_all",       mthdc_rotate_by_all },
+      { "transform_by_all",    mthdc_transform_by_all },
+      { "nearest_index",       mthdc_nearest_index },
+      { "min_all",             mthdc_min_all },
+      { "max_all",             mthdc_max_all },
+    };
+
   } // namespace
 
 //---------------------------------------------------------------------------------------
@@ -606,6 +773,7 @@ void SkVector3::register_bindings()
   tBindingBase::register_bindings("Vector3");
 
   ms_class_p->register_method_func_bulk(SkVector3_Impl::methods_i, A_COUNT_OF(SkVector3_Impl::methods_i), SkBindFlag_instance_no_rebind);
+  ms_class_p->register_method_func_bulk(SkVector3_Impl::methods_c, A_COUNT_OF(SkVector3_Impl::methods_c), SkBindFlag_class_no_rebind);
 
   ms_class_p->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_struct<SkVector3>);
   SkUEClassBindingHelper::resolve_raw_data_struct(ms_class_p, TEXT("Vector"));
@@ -28,6 +28,7 @@
 #include "SkRotationAngles.hpp"
 
 #include <SkookumScript/SkBoolean.hpp>
+#include <SkookumScript/SkList.hpp>
 #include <SkookumScript/SkReal.hpp>
 
 //=======================================================================================
@@ -498,6 +499,98 @@ namespace SkVector4_Impl
     }
   */
 
+  //---------------------------------------------------------------------------------------
+  // Bulk operations on lists of vectors
+  // These work directly on the FVector4s stored in the list items so no intermediate
+  // instances are created, and use UE4's vector registers (SSE/NEON) for the math.
+  //---------------------------------------------------------------------------------------
+
+  //---------------------------------------------------------------------------------------
+  // Return list passed in as first argument if result desired
+  static void return_list_arg(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    if (result_pp)
+      {
+      SkInstance * list_p = scope_p->get_arg(SkArg_1);
+      list_p->reference();
+      *result_pp = list_p;
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector4@add_assign_all({Vector4} vecs, Vector4 vec) {Vector4}
+  static void mthdc_add_assign_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+    const VectorRegister vec_reg = VectorLoad(&scope_p->get_arg<SkVector4>(SkArg_2));
+
+    for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+      {
+      FVector4 & item = (*item_pp)->as<SkVector4>();
+      VectorStore(VectorAdd(VectorLoad(&item), vec_reg), &item);
+      }
+
+    return_list_arg(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector4@multiply_assign_all({Vector4} vecs, Real num) {Vector4}
+  static void mthdc_multiply_assign_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+    const VectorRegister num_reg = VectorSetFloat1(scope_p->get_arg<SkReal>(SkArg_2));
+
+    for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+      {
+      FVector4 & item = (*item_pp)->as<SkVector4>();
+      VectorStore(VectorMultiply(VectorLoad(&item), num_reg), &item);
+      }
+
+    return_list_arg(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector4@min_all({Vector4} vecs) Vector4
+  static void mthdc_min_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+      VectorRegister min_reg = VectorSetFloat1(BIG_NUMBER);
+
+      for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+        {
+        min_reg = VectorMin(min_reg, VectorLoad(&(*item_pp)->as<SkVector4>()));
+        }
+
+      FVector4 min_vec;
+      VectorStore(min_reg, &min_vec);
+      *result_pp = SkVector4::new_instance(list.get_length() ? min_vec : FVector4(0.0f, 0.0f, 0.0f, 0.0f));
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector4@max_all({Vector4} vecs) Vector4
+  static void mthdc_max_all(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+      VectorRegister max_reg = VectorSetFloat1(-BIG_NUMBER);
+
+      for (SkInstance ** item_pp = list.get_array(), ** end_pp = list.get_array_end(); item_pp < end_pp; ++item_pp)
+        {
+        max_reg = VectorMax(max_reg, VectorLoad(&(*item_pp)->as<SkVector4>()));
+        }
+
+      FVector4 max_vec;
+      VectorStore(max_reg, &max_vec);
+      *result_pp = SkVector4::new_instance(list.get_length() ? max_vec : FVector4(0.0f, 0.0f, 0.0f, 0.0f));
+      }
+    }
+
   //---------------------------------------------------------------------------------------
 
   // Instance method array
@@ -545,6 +638,15 @@ namespace SkVector4_Impl
       //{ "normalize",        mthd_normalize },
     };
 
+  // Class method array
+  static const SkClass::MethodInitializerFunc methods_c[] =
+    {
+      { "add_assign_all",      mthdc_add_assign_all },
+      { "multiply_assign_all", mthdc_multiply_assign_all },
+      { "min_all",             mthdc_min_all },
+      { "max_all",             mthdc_max_all },
+    };
+
   } // namespace
 
 //---------------------------------------------------------------------------------------
@@ -553,6 +655,7 @@ void SkVector4::register_bindings()
   tBindingBase::register_bindings("Vector4");
 
   ms_class_p->register_method_func_bulk(SkVector4_Impl::methods_i, A_COUNT_OF(SkVector4_Impl::methods_i), SkBindFlag_instance_no_rebind);
+  ms_class_p->register_method_func_bulk(SkVector4_Impl::methods_c, A_COUNT_OF(SkVector4_Impl::methods_c), SkBindFlag_class_no_rebind);
 
   ms_class_p->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_struct<SkVector4>);
   SkUEClassBindingHelper::resolve_raw_data_struct(ms_class_p, TEXT("Vector4"));
@@ -116,6 +116,7 @@ void USkookumScriptClassDataComponent::create_sk_instance()
 
   // Currently, we support only actors
   SK_ASSERTX(sk_class_p->is_actor_class(), a_str_format("Trying to create a SkookumScriptClassDataComponent of class '%s' which is not an actor.", sk_class_p->get_name_cstr_dbg()));
+  SkUEClassBindingHelper::ensure_class_loaded(sk_class_p);
   SkInstance * instance_p;
   uint32_t instance_offset = sk_class_p->get_user_data_int();
   if (instance_offset)
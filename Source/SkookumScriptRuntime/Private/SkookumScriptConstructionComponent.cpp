@@ -89,6 +89,7 @@ void USkookumScriptConstructionComponent::InitializeComponent()
           #endif
 
           sk_class_p->set_user_data_int_recursively(instance_offset);
+          SkUEClassBindingHelper::invalidate_object_class_cache();
           }
         }
       SK_ASSERTX(instance_offset, a_str_format("Class '%s' has no embedded instance offset to create an SkInstance for actor '%S'!", sk_class_p->get_name_cstr(), *actor_p->GetName()));
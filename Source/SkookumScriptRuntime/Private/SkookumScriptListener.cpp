@@ -58,13 +58,33 @@ FSkookumScriptListenerAutoPtr::~FSkookumScriptListenerAutoPtr()
 
 USkookumScriptListener::USkookumScriptListener(const FObjectInitializer& ObjectInitializer)
   : Super(ObjectInitializer)
+  , m_event_queue_p(nullptr)
+  , m_event_queue_capacity(0)
+  , m_event_first(0)
+  , m_event_count(0)
   , m_num_arguments(0)
+  , m_is_single_event(false)
+  , m_stats_p(nullptr)
   , m_unregister_callback_p(nullptr)
   {
   }
 
 //---------------------------------------------------------------------------------------
 
+void USkookumScriptListener::BeginDestroy()
+  {
+  if (m_event_queue_p)
+    {
+    FMemory::Free(m_event_queue_p);
+    m_event_queue_p = nullptr;
+    m_event_queue_capacity = 0;
+    }
+
+  Super::BeginDestroy();
+  }
+
+//---------------------------------------------------------------------------------------
+
 void USkookumScriptListener::initialize(UObject * obj_p, SkInvokedCoroutine * coro_p, tUnregisterCallback callback_p)
   {
   SK_ASSERTX(!coro_p->is_suspended(), "Coroutine must not be suspended yet when delegate object is initialized.");
@@ -73,6 +93,8 @@ void USkookumScriptListener::initialize(UObject * obj_p, SkInvokedCoroutine * co
   m_coro_p = coro_p;
   m_unregister_callback_p = callback_p;
   m_num_arguments = 0;
+  m_is_single_event = false;
+  m_stats_p = SkookumScriptListenerManager::get_singleton()->get_event_stats(obj_p->GetClass());
   }
 
 //---------------------------------------------------------------------------------------
@@ -80,10 +102,13 @@ void USkookumScriptListener::initialize(UObject * obj_p, SkInvokedCoroutine * co
 void USkookumScriptListener::deinitialize()
   {
   // Kill any events that are still around
+  EventInfo event;
   while (has_event())
     {
-    free_event(pop_event(), true);
+    pop_event(&event);
+    free_event(&event, true);
     }
+  m_event_first = 0;
 
   // Forget the coroutine we keep track of
   m_coro_p.null();
@@ -96,10 +121,16 @@ void USkookumScriptListener::deinitialize()
   }
 
 //---------------------------------------------------------------------------------------
-
+// Returns slot at the end of the event queue to fill in - it is only added to the queue by
+// push_event_and_resume()
 USkookumScriptListener::EventInfo * USkookumScriptListener::alloc_event()
   {
-  EventInfo * event_p = SkookumScriptListenerManager::get_singleton()->alloc_event();
+  if (m_event_count == m_event_queue_capacity)
+    {
+    grow_event_queue();
+    }
+
+  EventInfo * event_p = &m_event_queue_p[(m_event_first + m_event_count) & (m_event_queue_capacity - 1u)];
   #if (SKOOKUM & SK_DEBUG)
     ::memset(event_p->m_argument_p, 0, sizeof(event_p->m_argument_p));
   #endif
@@ -110,21 +141,72 @@ USkookumScriptListener::EventInfo * USkookumScriptListener::alloc_event()
 
 void USkookumScriptListener::free_event(EventInfo * event_p, bool free_arguments)
   {
-  SkookumScriptListenerManager::get_singleton()->free_event(event_p, free_arguments ? m_num_arguments : 0);
+  if (free_arguments)
+    {
+    for (uint32_t i = 0; i < m_num_arguments; ++i)
+      {
+      event_p->m_argument_p[i]->dereference();
+      }
+    }
   }
 
 //---------------------------------------------------------------------------------------
-
+// Adds event previously obtained via alloc_event() to the queue
+// The coroutine is only resumed by the first event of a burst - it then processes all
+// events that queued up in the meantime in one go
 void USkookumScriptListener::push_event_and_resume(EventInfo * event_p, uint32_t num_arguments)
   {
+  SK_ASSERTX(event_p == &m_event_queue_p[(m_event_first + m_event_count) & (m_event_queue_capacity - 1u)], "Event must have been obtained from alloc_event() of the same listener.");
   #if (SKOOKUM & SK_DEBUG)
     for (uint32_t i = 0; i < num_arguments; ++i) SK_ASSERTX(event_p->m_argument_p[i], "All event arguments must be set.");
     for (uint32_t i = num_arguments; i < A_COUNT_OF(event_p->m_argument_p); ++i) SK_ASSERTX(!event_p->m_argument_p[i], "Unused event arguments must be left alone.");
     SK_ASSERTX(m_num_arguments == 0 || m_num_arguments == num_arguments, "All events must have same argument count.");
   #endif
   m_num_arguments = num_arguments;
-  m_event_queue.append(event_p);
-  if (m_coro_p.is_valid()) m_coro_p->resume();
+  bool is_first_event = (m_event_count == 0u);
+  ++m_event_count;
+
+  // Keep statistics
+  EventStats & stats = *m_stats_p;
+  ++stats.m_event_count;
+  if (stats.m_frame != GFrameCounter)
+    {
+    stats.m_frame = GFrameCounter;
+    stats.m_frame_event_count = 0u;
+    }
+  if (++stats.m_frame_event_count > stats.m_frame_event_count_max)
+    {
+    stats.m_frame_event_count_max = stats.m_frame_event_count;
+    }
+  if (m_event_count > stats.m_queue_depth_max)
+    {
+    stats.m_queue_depth_max = m_event_count;
+    }
+
+  if (is_first_event && m_coro_p.is_valid())
+    {
+    ++stats.m_resume_count;
+    m_coro_p->resume();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Doubles the capacity of the event queue, unwrapping the ring buffer in the process
+void USkookumScriptListener::grow_event_queue()
+  {
+  uint32_t capacity = m_event_queue_capacity ? m_event_queue_capacity * 2u : uint32_t(EventQueue_initial_capacity);
+  EventInfo * event_queue_p = static_cast<EventInfo *>(FMemory::Malloc(capacity * sizeof(EventInfo)));
+  for (uint32_t i = 0; i < m_event_count; ++i)
+    {
+    event_queue_p[i] = m_event_queue_p[(m_event_first + i) & (m_event_queue_capacity - 1u)];
+    }
+  if (m_event_queue_p)
+    {
+    FMemory::Free(m_event_queue_p);
+    }
+  m_event_queue_p = event_queue_p;
+  m_event_queue_capacity = capacity;
+  m_event_first = 0u;
   }
 
 //---------------------------------------------------------------------------------------
@@ -165,7 +247,9 @@ bool USkookumScriptListener::coro_on_event_do(SkInvokedCoroutine * scope_p, tReg
   do
     {
     // Use event parameters to invoke closure, then recycle event
-    USkookumScriptListener::EventInfo * event_p = listener_p->pop_event();
+    USkookumScriptListener::EventInfo event;
+    USkookumScriptListener::EventInfo * event_p = &event;
+    listener_p->pop_event(event_p);
     if (do_until)
       {
       // Add reference to potential return values so they survive closure_method_call 
@@ -226,6 +310,7 @@ bool USkookumScriptListener::coro_wait_event(SkInvokedCoroutine * scope_p, tUnre
 
     // Install and store away event listener
     USkookumScriptListener * listener_p = SkookumScriptListenerManager::get_singleton()->alloc_listener(this_p, scope_p, unregister_f);
+    listener_p->m_is_single_event = true; // Don't bother building events beyond the first one
     scope_p->append_user_data<FSkookumScriptListenerAutoPtr, USkookumScriptListener *>(listener_p);
     (*register_f)(this_p, listener_p);
 
@@ -245,12 +330,13 @@ bool USkookumScriptListener::coro_wait_event(SkInvokedCoroutine * scope_p, tUnre
   SkClosure * closure_p = scope_p->get_arg_data<SkClosure>(SkArg_1);
   uint32_t num_arguments = listener_p->get_num_arguments();
   bool exit = false;
-  USkookumScriptListener::EventInfo * event_p = listener_p->pop_event();
+  USkookumScriptListener::EventInfo event;
+  listener_p->pop_event(&event);
   for (uint32_t i = 0; i < num_arguments; ++i)
     {
-    scope_p->set_arg(SkArg_1 + i, event_p->m_argument_p[i]); // Store parameters as return values if exiting
+    scope_p->set_arg(SkArg_1 + i, event.m_argument_p[i]); // Store parameters as return values if exiting
     }
-  listener_p->free_event(event_p, false);
+  listener_p->free_event(&event, false);
 
   // Ok done, return event parameters and quit
   return true;
@@ -30,6 +30,32 @@
 #include <SkookumScript/SkDebug.hpp>
 
 #include "UObject/Package.h"
+#include "HAL/IConsoleManager.h"
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+  {
+
+  //---------------------------------------------------------------------------------------
+
+  void cmd_listener_stats(const TArray<FString> & args)
+    {
+    if (SkUERuntime::get_singleton())
+      {
+      SkookumScriptListenerManager::get_singleton()->print_event_stats();
+      }
+    }
+
+  FAutoConsoleCommand g_cmd_listener_stats(TEXT("sk.Listener.Stats"), TEXT("Prints the events received by SkookumScript listeners per class."), FConsoleCommandWithArgsDelegate::CreateStatic(&cmd_listener_stats));
+
+  } // End unnamed namespace
+
+#endif  // !UE_BUILD_SHIPPING
 
 //---------------------------------------------------------------------------------------
 
@@ -43,7 +69,6 @@ SkookumScriptListenerManager * SkookumScriptListenerManager::get_singleton()
 
 SkookumScriptListenerManager::SkookumScriptListenerManager(uint32_t pool_init, uint32_t pool_incr)
   : m_pool_incr(pool_incr)
-  , m_event_pool(pool_init, pool_incr) // $Revisit MBreyer - use separate settings for delegate objects and events
   {
   // Find package to attach listener objects to
   m_module_package_p = FindObject<UPackage>(nullptr, TEXT("/Script/SkookumScriptRuntime"));
@@ -80,6 +105,11 @@ SkookumScriptListenerManager::~SkookumScriptListenerManager()
       listener_p->MarkPendingKill();
       }
     }
+
+  for (auto & stats_pair : m_event_stats)
+    {
+    delete stats_pair.Value;
+    }
   }
 
 //---------------------------------------------------------------------------------------
@@ -125,3 +155,31 @@ void SkookumScriptListenerManager::grow_inactive_list(uint32_t pool_incr)
   m_active_list.ensure_size(m_inactive_list.get_length());
   }
 
+//---------------------------------------------------------------------------------------
+// Returns statistics of events received from objects of the given class
+USkookumScriptListener::EventStats * SkookumScriptListenerManager::get_event_stats(UClass * ue_class_p)
+  {
+  FName class_name = ue_class_p->GetFName();
+  USkookumScriptListener::EventStats ** stats_pp = m_event_stats.Find(class_name);
+  if (stats_pp)
+    {
+    return *stats_pp;
+    }
+
+  USkookumScriptListener::EventStats * stats_p = new USkookumScriptListener::EventStats(class_name);
+  m_event_stats.Add(class_name, stats_p);
+  return stats_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Prints event statistics of all classes listened to
+void SkookumScriptListenerManager::print_event_stats() const
+  {
+  ADebug::print_format("\nListener events - %u listeners active\n", m_active_list.get_length());
+  ADebug::print_format("  %-40s %10s %10s %10s %10s\n", "Class", "Events", "Peak/frame", "Peak queue", "Resumes");
+  for (auto & stats_pair : m_event_stats)
+    {
+    const USkookumScriptListener::EventStats & stats = *stats_pair.Value;
+    ADebug::print_format("  %-40S %10u %10u %10u %10u\n", *stats.m_class_name.ToString(), stats.m_event_count, stats.m_frame_event_count_max, stats.m_queue_depth_max, stats.m_resume_count);
+    }
+  }
@@ -55,13 +55,13 @@ class SkookumScriptListenerManager
     USkookumScriptListener *                alloc_listener(UObject * obj_p, SkInvokedCoroutine * coro_p, USkookumScriptListener::tUnregisterCallback callback_p);
     void                                    free_listener(USkookumScriptListener * listener_p);
 
-    USkookumScriptListener::EventInfo *     alloc_event();
-    void                                    free_event(USkookumScriptListener::EventInfo * event_p, uint32_t num_arguments_to_free);
+    USkookumScriptListener::EventStats *    get_event_stats(UClass * ue_class_p);
+    void                                    print_event_stats() const;
 
   protected:
 
     typedef APArray<USkookumScriptListener> tObjPool;
-    typedef AObjReusePool<USkookumScriptListener::EventInfo> tEventPool;
+    typedef TMap<FName, USkookumScriptListener::EventStats *> tEventStatsMap;
 
     void        grow_inactive_list(uint32_t pool_incr);
 
@@ -69,31 +69,8 @@ class SkookumScriptListenerManager
     tObjPool    m_active_list;
     uint32_t    m_pool_incr;
 
-    tEventPool  m_event_pool;
+    tEventStatsMap m_event_stats; // Allocated individually so listeners can keep pointers to them
 
     UPackage *  m_module_package_p;
 
   }; // SkookumScriptListenerManager
-
-//=======================================================================================
-// Inline Functions
-//=======================================================================================
-
-//---------------------------------------------------------------------------------------
-
-inline USkookumScriptListener::EventInfo * SkookumScriptListenerManager::alloc_event()
-  {
-  return m_event_pool.allocate();
-  }
-
-//---------------------------------------------------------------------------------------
-            
-inline void SkookumScriptListenerManager::free_event(USkookumScriptListener::EventInfo * event_p, uint32_t num_arguments_to_free)
-  {
-  for (uint32_t i = 0; i < num_arguments_to_free; ++i)
-    {
-    event_p->m_argument_p[i]->dereference();
-    }
-  m_event_pool.recycle(event_p);
-  }
-
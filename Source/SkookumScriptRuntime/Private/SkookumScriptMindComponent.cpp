@@ -26,6 +26,7 @@
 //=======================================================================================
 
 #include "SkookumScriptMindComponent.h"
+#include "Bindings/SkUEClassBinding.hpp"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
 #include "Runtime/Launch/Resources/Version.h" // TEMP HACK for ENGINE_MINOR_VERSION
@@ -81,6 +82,7 @@ void USkookumScriptMindComponent::create_sk_instance()
     }
 
   // Based on the desired class, create SkInstance or SkDataInstance
+  SkUEClassBindingHelper::ensure_class_loaded(class_p);
   m_mind_instance_p = class_p->new_instance();
   }
 
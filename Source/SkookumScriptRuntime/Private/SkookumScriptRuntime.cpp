@@ -25,7 +25,9 @@
 #include "Bindings/SkUEClassBinding.hpp"
 #include "Bindings/SkUERuntime.hpp"
 #include "Bindings/SkUERemote.hpp"
+#include "Bindings/SkUEProfiler.hpp"
 #include "Bindings/SkUEReflectionManager.hpp"
+#include "Bindings/SkUESlabAllocator.hpp"
 #include "Bindings/SkUESymbol.hpp"
 #include "Bindings/SkUEUtils.hpp"
 #include "Bindings/Engine/SkUEName.hpp"
@@ -58,6 +60,15 @@
 // For profiling SkookumScript performance
 DECLARE_CYCLE_STAT(TEXT("SkookumScript Time"), STAT_SkookumScriptTime, STATGROUP_Game);
 
+// If small AgogCore/SkookumScript allocations are served from fixed size pools
+// (SkUESlabAllocator) rather than going straight to FMemory - compare with sk.Bench.Alloc
+// on the target platform before enabling.  This includes the pointer arrays that hold
+// the data members of script objects (SkDataInstance::m_data) which by default come from
+// FMemory like every other allocation.
+#ifndef SKOOKUM_FIXED_SIZE_POOLS
+  #define SKOOKUM_FIXED_SIZE_POOLS 0
+#endif
+
 //---------------------------------------------------------------------------------------
 // UE4 implementation of AAppInfoCore
 class FAppInfo : public AAppInfoCore, public SkAppInfo
@@ -230,6 +241,7 @@ class FSkookumScriptRuntime : public ISkookumScriptRuntime
     FDelegateHandle         m_on_world_init_pre_handle;
     FDelegateHandle         m_on_world_init_post_handle;
     FDelegateHandle         m_on_world_cleanup_handle;
+    FDelegateHandle         m_on_post_gc_handle;
 
     #if WITH_EDITORONLY_DATA
       FDelegateHandle       m_on_pre_compile_handle;
@@ -244,11 +256,13 @@ class FSkookumScriptRuntime : public ISkookumScriptRuntime
 
     static TCHAR const * const ms_ini_section_name_p;
     static TCHAR const * const ms_ini_key_last_connected_to_ide_p;
+    static TCHAR const * const ms_ini_key_demand_unload_idle_minutes_p;
 
   };
 
 TCHAR const * const FSkookumScriptRuntime::ms_ini_section_name_p = TEXT("SkookumScriptRuntime");
 TCHAR const * const FSkookumScriptRuntime::ms_ini_key_last_connected_to_ide_p = TEXT("LastConnectedToIDE");
+TCHAR const * const FSkookumScriptRuntime::ms_ini_key_demand_unload_idle_minutes_p = TEXT("DemandUnloadIdleMinutes");
 
 //---------------------------------------------------------------------------------------
 // Simple error dialog until more sophisticated one in place.
@@ -396,29 +410,43 @@ FAppInfo::~FAppInfo()
 
 void * FAppInfo::malloc(size_t size, const char * debug_name_p)
   {
-  return size ? FMemory::Malloc(size, 16) : nullptr; // $Revisit - MBreyer Make alignment controllable by caller
+  #if SKOOKUM_FIXED_SIZE_POOLS
+    return size ? SkUESlabAllocator::get().allocate(size, debug_name_p) : nullptr;
+  #else
+    return size ? FMemory::Malloc(size, 16) : nullptr; // $Revisit - MBreyer Make alignment controllable by caller
+  #endif
   }
 
 //---------------------------------------------------------------------------------------
 
 void FAppInfo::free(void * mem_p)
   {
-  if (mem_p) FMemory::Free(mem_p); // $Revisit - MBreyer Make alignment controllable by caller
+  #if SKOOKUM_FIXED_SIZE_POOLS
+    // Also hands memory not from the pools on to FMemory
+    SkUESlabAllocator::get().deallocate(mem_p);
+  #else
+    if (mem_p) FMemory::Free(mem_p); // $Revisit - MBreyer Make alignment controllable by caller
+  #endif
   }
 
 //---------------------------------------------------------------------------------------
 
 uint32_t FAppInfo::request_byte_size(uint32_t size_requested)
   {
-  // Since we call the 16-byte aligned allocator
-  return a_align_up(size_requested, 16);
+  #if SKOOKUM_FIXED_SIZE_POOLS
+    // Round up to the size class so the slack can be used
+    return SkUESlabAllocator::request_byte_size(size_requested);
+  #else
+    // Since we call the 16-byte aligned allocator
+    return a_align_up(size_requested, 16);
+  #endif
   }
 
 //---------------------------------------------------------------------------------------
 
 bool FAppInfo::is_using_fixed_size_pools()
   {
-  return false;
+  return SKOOKUM_FIXED_SIZE_POOLS != 0;
   }
 
 //---------------------------------------------------------------------------------------
@@ -602,6 +630,9 @@ void FSkookumScriptRuntime::StartupModule()
   m_on_world_init_post_handle   = FWorldDelegates::OnPostWorldInitialization.AddRaw(this, &FSkookumScriptRuntime::on_world_init_post);
   m_on_world_cleanup_handle     = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FSkookumScriptRuntime::on_world_cleanup);
 
+  // Garbage collection may recycle the memory of unloaded classes
+  m_on_post_gc_handle           = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&SkUEClassBindingHelper::purge_object_class_cache);
+
   #if WITH_EDITORONLY_DATA
     // Install this class as a "compiler" so we know when a Blueprint is about to be compiled
     IKismetCompilerInterface & kismet_compiler = FModuleManager::LoadModuleChecked<IKismetCompilerInterface>(KISMET_COMPILER_MODULENAME);
@@ -644,6 +675,8 @@ void FSkookumScriptRuntime::on_world_init_pre(UWorld * world_p, const UWorld::In
       m_game_world_p = world_p;
 
       // Make sure all UE4 classes that have been loaded along with this world are bound
+      // - revisit all classes as clean ones may have lost their UE4 counterparts since
+      m_runtime.get_reflection_manager()->mark_all_dirty();
       m_runtime.sync_all_reflected_to_ue(true);
 
       // When the first game world is initialized, do some last minute binding
@@ -779,6 +812,7 @@ void FSkookumScriptRuntime::ShutdownModule()
   FWorldDelegates::OnPreWorldInitialization.Remove(m_on_world_init_pre_handle);
   FWorldDelegates::OnPostWorldInitialization.Remove(m_on_world_init_post_handle);
   FWorldDelegates::OnWorldCleanup.Remove(m_on_world_cleanup_handle);
+  FCoreUObjectDelegates::GetPostGarbageCollect().Remove(m_on_post_gc_handle);
 
   #if WITH_EDITORONLY_DATA
     IKismetCompilerInterface * kismet_compiler_p = FModuleManager::GetModulePtr<IKismetCompilerInterface>(KISMET_COMPILER_MODULENAME);
@@ -830,6 +864,11 @@ void FSkookumScriptRuntime::load_ini_settings()
     GConfig->GetString(ms_ini_section_name_p, ms_ini_key_last_connected_to_ide_p, last_connected_to_ide, ini_file_path);
     m_remote_client.set_last_connected_to_ide(!last_connected_to_ide.IsEmpty() && last_connected_to_ide[0] == '1');
   #endif
+
+  // Demand loaded class groups are never unloaded unless an idle time is specified
+  float demand_unload_idle_minutes = 0.0f;
+  GConfig->GetFloat(ms_ini_section_name_p, ms_ini_key_demand_unload_idle_minutes_p, demand_unload_idle_minutes, ini_file_path);
+  m_runtime.set_demand_unload_idle_time(f64(demand_unload_idle_minutes) * 60.0);
   }
 
 //---------------------------------------------------------------------------------------
@@ -1036,7 +1075,11 @@ void FSkookumScriptRuntime::tick_game(float deltaTime)
   #endif
       {
       SCOPE_CYCLE_COUNTER(STAT_SkookumScriptTime);
+      SKUE_PROFILE_SCOPE("SkookumScript update");
+      // Minds are updated one after another on the game thread - the mind lists and the
+      // invoked object pools (AObjReusePool) are owned by the core and not thread safe
       m_runtime.update(deltaTime);
+      m_runtime.update_demand_loaded_classes();
       }
   }
 
@@ -1083,6 +1126,7 @@ void FSkookumScriptRuntime::tick_remote()
       // Needs to be called whether in editor or game and whether paused or not
       // $Revisit - CReis This is probably a hack. The remote client update should probably
       // live somewhere other than a tick method such as its own thread.
+      m_remote_client.process_outgoing();
       m_remote_client.process_incoming();
 
       // Re-load compiled binaries?
@@ -1305,6 +1349,9 @@ void FSkookumScriptRuntime::on_class_added_or_modified(UBlueprint * blueprint_p)
   UClass * ue_class_p = blueprint_p->GeneratedClass;
   if (ue_class_p && !is_dormant())
     {
+    // Class layout and hierarchy might have changed
+    SkUEClassBindingHelper::invalidate_object_class_cache();
+
     // Generate script files for the new/changed class
     m_generator.update_class_script_file(ue_class_p, false, true);
     m_generator.update_used_class_script_files(true);
@@ -1319,7 +1366,8 @@ void FSkookumScriptRuntime::on_class_added_or_modified(UBlueprint * blueprint_p)
         SkUEReflectionManager::add_instance_property_to_class(ue_class_p, sk_class_p);
         }
 
-      // Re-expose all functions as some might have been regenerated
+      // Re-expose the functions of this class as some might have been regenerated
+      m_runtime.get_reflection_manager()->mark_class_dirty(sk_class_p);
       m_runtime.sync_all_reflected_to_ue(true);
 
       // Re-resolve the raw data if applicable
@@ -1463,6 +1511,7 @@ void FSkookumScriptRuntime::on_new_asset(UObject * obj_p)
 void FSkookumScriptRuntime::OnPreCompile()
   {
   // Last minute attempt to resolve yet unresolved bindings
+  m_runtime.get_reflection_manager()->mark_all_dirty();
   m_runtime.sync_all_reflected_to_ue(true);
 
   // Make sure all Blueprints are instrumented at this point
@@ -1496,6 +1545,7 @@ void FSkookumScriptRuntime::on_blueprint_compiled(UBlueprint * blueprint_p)
 void FSkookumScriptRuntime::PreCompile(UBlueprint * blueprint_p)
   {
   // At this point, all bindings must be resolved
+  m_runtime.get_reflection_manager()->mark_all_dirty();
   m_runtime.sync_all_reflected_to_ue(true);
   }
 
@@ -837,7 +837,7 @@ void FSkookumScriptRuntimeGenerator::create_root_class_script_file(const TCHAR *
     {
     // Write file and update time stamp
     cached_file_p->m_body = body;
-    cached_file_p->m_sk_super_name = ASymbol::create("Object"); // Don't use ASymbol_Object here as it might not be initialized yet
+    cached_file_p->m_sk_super_name = ASYMBOL_LITERAL("Object"); // Don't use ASymbol_Object here as it might not be initialized yet
     FString new_file_path = m_overlay_path / cached_file_p->get_file_name();
     if (cached_file_p->save(new_file_path))
       {
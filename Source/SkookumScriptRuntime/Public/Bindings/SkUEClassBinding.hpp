@@ -96,6 +96,9 @@ class SKOOKUMSCRIPTRUNTIME_API SkUEClassBindingHelper
     static SkClass *       get_object_class(UObject * obj_p, UClass * def_ue_class_p = nullptr, SkClass * def_sk_class_p = nullptr); // Determine SkookumScript class from UClass
     static SkInstance *    get_embedded_instance(UObject * obj_p, SkClass * sk_class_p);
     static SkInstance *    get_embedded_instance(AActor * actor_p, SkClass * sk_class_p);
+    static void            ensure_class_loaded(SkClass * sk_class_p);
+    static void            invalidate_object_class_cache() { ms_object_class_infos.Reset(); }
+    static void            purge_object_class_cache();
 
     static FString         get_ue_class_name_sans_c(UClass * ue_class_p);
 
@@ -115,6 +118,7 @@ class SKOOKUMSCRIPTRUNTIME_API SkUEClassBindingHelper
     static SkInstance *    access_raw_data_color(void * obj_p, tSkRawDataInfo raw_data_info, SkClassDescBase * data_type_p, SkInstance * value_p);
     static SkInstance *    access_raw_data_list(void * obj_p, tSkRawDataInfo raw_data_info, SkClassDescBase * data_type_p, SkInstance * value_p);
     static SkInstance *    access_raw_data_user_struct(void * obj_p, tSkRawDataInfo raw_data_info, SkClassDescBase * data_type_p, SkInstance * value_p);
+    static SkInstance *    new_list_from_raw_array(const void * items_p, uint32_t num_elements, uint32_t item_size, tSkRawDataInfo item_raw_data_info, SkClassDescBase * item_type_p);
 
     template<class _BindingClass>
     static SkInstance *    access_raw_data_struct(void * obj_p, tSkRawDataInfo raw_data_info, SkClassDescBase * data_type_p, SkInstance * value_p);
@@ -139,6 +143,29 @@ class SKOOKUMSCRIPTRUNTIME_API SkUEClassBindingHelper
 
   protected:
 
+    static void            use_demand_loaded_class(SkClass * sk_class_p);
+
+    // What get_object_class() and get_embedded_instance() resolve to for a given UClass
+    struct ObjectClassInfo
+      {
+      enum eLookup
+        {
+        Lookup_offset             = 1 << 0, // SkInstance pointer is stored at m_instance_offset inside the object
+        Lookup_actor_component    = 1 << 1, // Try USkookumScriptClassDataComponent of the actor
+        Lookup_behavior_component = 1 << 2, // Object is a USkookumScriptBehaviorComponent
+        };
+
+      TWeakObjectPtr<UClass> m_ue_class;        // UClass this entry was resolved for - goes stale when the class is garbage collected
+      SkClass *              m_sk_class_p;      // Most derived SkClass known for m_ue_class
+      uint32_t               m_instance_offset; // Byte offset of the embedded SkInstance pointer or 0
+      uint32_t               m_lookup;          // Combination of eLookup flags
+      };
+
+    static const ObjectClassInfo & get_object_class_info(UClass * ue_class_p);
+    static const ObjectClassInfo & resolve_object_class_info(UClass * ue_class_p);
+    static void                    compute_embedded_instance_lookup(ObjectClassInfo * info_p, UClass * ue_class_p, SkClass * sk_class_p);
+    static SkInstance *            get_embedded_instance(UObject * obj_p, const ObjectClassInfo & info);
+
     // A few handy symbol id constants
     enum
       {
@@ -246,6 +273,8 @@ class SKOOKUMSCRIPTRUNTIME_API SkUEClassBindingHelper
     static TMap<SkClassDescBase*, TWeakObjectPtr<UBlueprint>> ms_dynamic_class_map_s2u; // Maps SkClasses to their respective Blueprints
   #endif
 
+    static TMap<UClass*, ObjectClassInfo>                     ms_object_class_infos; // Only classes of objects seen by SkookumScript - flushed whenever class mappings change
+
     static int32_t      get_world_data_idx();
     static int32_t      ms_world_data_idx;
 
@@ -313,6 +342,7 @@ class SkUEClassBindingEntity : public SkClassBindingBase<_BindingClass, SkUEWeak
         }
       else
         {
+        SkUEClassBindingHelper::ensure_class_loaded(sk_class_p);
         instance_p = sk_class_p->new_instance();
         instance_p->construct<tBindingBase>(obj_p);
         }
@@ -485,6 +515,18 @@ inline bool SkUEClassBindingHelper::is_static_enum_registered(UEnum * ue_enum_p)
 
 #endif
 
+//---------------------------------------------------------------------------------------
+// Demand loads the script members of a class if it belongs to a demand loaded class group
+// and notes that its group is in use so that it is not unloaded while still needed.
+// Called on every instance creation and reflected call.
+inline void SkUEClassBindingHelper::ensure_class_loaded(SkClass * sk_class_p)
+  {
+  if (sk_class_p->is_demand_loaded())
+    {
+    use_demand_loaded_class(sk_class_p);
+    }
+  }
+
 //---------------------------------------------------------------------------------------
 
 inline SkClass * SkUEClassBindingHelper::get_sk_class_from_ue_class(UClass * ue_class_p)
@@ -517,6 +559,14 @@ inline SkClass * SkUEClassBindingHelper::get_sk_class_from_ue_class(UClass * ue_
   return find_sk_class_from_ue_class(ue_class_p);
   }
 
+//---------------------------------------------------------------------------------------
+// Look up cached class info of a UClass, resolving it if not cached yet
+inline const SkUEClassBindingHelper::ObjectClassInfo & SkUEClassBindingHelper::get_object_class_info(UClass * ue_class_p)
+  {
+  const ObjectClassInfo * info_p = ms_object_class_infos.Find(ue_class_p);
+  return info_p ? *info_p : resolve_object_class_info(ue_class_p);
+  }
+
 //---------------------------------------------------------------------------------------
 // Find our (static!) UE counterpart
 // If there is no direct match, crawl up the class hierarchy until we find a match
@@ -33,8 +33,6 @@
 #include "UnrealMath.h"          // Vector math functions.
 
 #include <AgogCore/AIdPtr.hpp>
-#include <AgogCore/AList.hpp>
-#include <AgogCore/AObjReusePool.hpp>
 #include <SkookumScript/SkUserData.hpp>
 
 #include "SkookumScriptListener.generated.h"
@@ -63,11 +61,23 @@ class SKOOKUMSCRIPTRUNTIME_API USkookumScriptListener : public UObject
 
   // Types
 
-    struct EventInfo : AListNode<EventInfo>
+    struct EventInfo
       {
       SkInstance *  m_argument_p[9];
+      };
 
-      EventInfo **  get_pool_unused_next() { return (EventInfo **)&m_argument_p[0]; } // Area in this class where to store the pointer to the next unused object when not in use
+    // Event statistics - kept per UE4 class that events are listened to on
+    struct EventStats
+      {
+      FName     m_class_name;             // Name of the class whose events are counted
+      uint64_t  m_frame;                  // Frame m_frame_event_count belongs to
+      uint32_t  m_event_count;            // Events received in total
+      uint32_t  m_frame_event_count;      // Events received during m_frame
+      uint32_t  m_frame_event_count_max;  // Peak events received during a single frame
+      uint32_t  m_queue_depth_max;        // Peak number of events waiting in a single listener's queue
+      uint32_t  m_resume_count;           // How often a coroutine was resumed to process queued events
+
+      EventStats(FName class_name) : m_class_name(class_name), m_frame(0u), m_event_count(0u), m_frame_event_count(0u), m_frame_event_count_max(0u), m_queue_depth_max(0u), m_resume_count(0u) {}
       };
 
     typedef void (*tRegisterCallback)(UObject *, USkookumScriptListener *);
@@ -82,21 +92,27 @@ class SKOOKUMSCRIPTRUNTIME_API USkookumScriptListener : public UObject
 
     uint32_t            get_num_arguments() const { return m_num_arguments; }
 
+    bool                is_accepting_event() const;
     bool                has_event() const;
-    EventInfo *         pop_event();
+    void                pop_event(EventInfo * out_event_p);
     void                free_event(EventInfo * event_p, bool free_arguments);
 
     static bool         coro_on_event_do(SkInvokedCoroutine * scope_p, tUnregisterCallback register_f, tUnregisterCallback unregister_f, bool do_until);
     static bool         coro_wait_event(SkInvokedCoroutine * scope_p, tUnregisterCallback register_f, tUnregisterCallback unregister_f);
 
+  // UObject Overrides
+
+    virtual void        BeginDestroy() override;
+
   protected:
 
-    friend class AObjReusePool<EventInfo>;
+    enum { EventQueue_initial_capacity = 4 }; // Must be a power of two
 
   // Internal Methods
 
-    static EventInfo *  alloc_event();
+    EventInfo *         alloc_event();
     void                push_event_and_resume(EventInfo * event_p, uint32_t num_arguments);
+    void                grow_event_queue();
     static void         add_dynamic_function(FName callback_name, UClass * callback_owner_class_p, Native exec_p);
     static void         remove_dynamic_function(FName callback_name);
 
@@ -104,8 +120,13 @@ class SKOOKUMSCRIPTRUNTIME_API USkookumScriptListener : public UObject
 
     FWeakObjectPtr              m_obj_p;                 // UObject we belong to
     AIdPtr<SkInvokedCoroutine>  m_coro_p;                // The coroutine that is suspended waiting for events from this object
-    AList<EventInfo>            m_event_queue;           // Queued up events waiting to be processed
+    EventInfo *                 m_event_queue_p;         // Ring buffer of queued up events waiting to be processed - kept when listener is recycled
+    uint32_t                    m_event_queue_capacity;  // Number of events m_event_queue_p can hold - power of two
+    uint32_t                    m_event_first;           // Index of oldest queued event
+    uint32_t                    m_event_count;           // Number of queued events
     uint32_t                    m_num_arguments;         // How many arguments the event has
+    bool                        m_is_single_event;       // Only the first event is of interest (coro_wait_event) so later ones are ignored until it is processed
+    EventStats *                m_stats_p;               // Where to count events received by this listener
     tUnregisterCallback         m_unregister_callback_p; // How to unregister myself from the delegate list I am hooked up to
 
   };  // USkookumScriptListener
@@ -131,14 +152,26 @@ template<> inline FSkookumScriptListenerAutoPtr * SkUserDataBase::as<FSkookumScr
 
 //---------------------------------------------------------------------------------------
 
-inline bool USkookumScriptListener::has_event() const
+inline bool USkookumScriptListener::is_accepting_event() const
   {
-  return !m_event_queue.is_empty();
+  // Nobody to process events or already got the single event that is wanted?
+  // Then skip building the event arguments altogether
+  return m_coro_p.is_valid() && !(m_is_single_event && m_event_count);
   }
 
 //---------------------------------------------------------------------------------------
 
-inline USkookumScriptListener::EventInfo * USkookumScriptListener::pop_event()
+inline bool USkookumScriptListener::has_event() const
+  {
+  return m_event_count != 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Copies oldest event out of the queue - copied so that the queue can be safely
+// appended to (and grow) while the event is being processed
+inline void USkookumScriptListener::pop_event(EventInfo * out_event_p)
   {
-  return m_event_queue.pop_first();
+  *out_event_p = m_event_queue_p[m_event_first];
+  m_event_first = (m_event_first + 1u) & (m_event_queue_capacity - 1u);
+  --m_event_count;
   }